@@ -1,505 +1,4376 @@
+// posix_madvise() and clock_gettime() are POSIX, not C: declare them even
+// under -std=c11
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L
+#endif
+
 #include <stdio.h>
-#include <string.h>
 #include <stdlib.h>
+#include <string.h>
 #include <limits.h>
 #include <float.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <time.h>
+#include <pthread.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+// x86 kernels for every instruction set are built whatever -march says
+// and chosen at load time, see CPU dispatch
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define CREADABLE_X86
+#include <immintrin.h>
+#endif
+
+#include "creadable.h"
+
+// Significant digits kept for the floating point conversion. 768 digits are
+// enough to decide the rounding of any double; anything past that is folded
+// into a single sticky digit so rounding still sees it.
+#define CREADABLE_MAX_DIGITS 768
+
+struct number {
+	unsigned long long value; // integer magnitude, meaningless if overflow is set
+	char overflow;
+	char negative;
+	char floating;
+	char bits; // bits per digit after 0x, 0o or 0b, 0 for decimal
+	int exponent; // digits[] has to be scaled by 10^exponent
+	size_t ndigits;
+	char digits[CREADABLE_MAX_DIGITS + 16]; // room for sticky digit and "e<exponent>"
+
+	// what went wrong, for report_error()
+	const char* error_at;
+	char separator;
+};
+
+static const char* separator_name(char separator, char buf[2]) {
+	if(separator == ' ') return "<space>";
+	if(separator == '\t') return "<tab>";
+	buf[0] = separator;
+	buf[1] = '\0';
+	return buf;
+}
+
+static enum rstatus use_separator(const char* p, struct number* n) {
+	if(n->separator == '\0') {
+		n->separator = *p;
+	}
+	else if(n->separator != *p) {
+		n->error_at = p;
+		return RSTATUS_SEPARATOR_MISMATCH;
+	}
+	return RSTATUS_OK;
+}
+
+// ===========================
+// Error reporting
+// ===========================
+
+// Formatting an error is kept out of the parsers and out of line: the
+// parsers only return a status, and the status-returning API never formats
+// anything at all.
+#if defined(__GNUC__)
+#define COLD __attribute__((cold, noinline))
+#else
+#define COLD
+#endif
+
+static void print_error(enum rstatus status, const char* message, void* context) {
+	(void)status;
+	(void)context;
+	fprintf(stderr, "%s\n", message);
+}
+
+static _Atomic(rerror_handler) error_handler = print_error;
+static void* _Atomic error_context = NULL;
+static atomic_uint error_rate = CREADABLE_ERROR_RATE;
+static atomic_llong error_window = 0; // the second the current budget belongs to
+static atomic_uint error_count = 0;
+static atomic_ulong error_suppressed = 0;
+
+CREADABLE_API void rset_error_handler(rerror_handler handler, void* context, unsigned max_per_second) {
+	atomic_store(&error_handler, handler ? handler : print_error);
+	atomic_store(&error_context, context);
+	atomic_store(&error_rate, max_per_second);
+	atomic_store(&error_count, 0);
+}
+
+// A fixed budget of messages per wall-clock second. Rejected errors cost
+// two atomic operations and are never formatted.
+static int admit_error(void) {
+	unsigned limit = atomic_load_explicit(&error_rate, memory_order_relaxed);
+	if(!limit) return 1;
+
+	long long second = (long long)time(NULL);
+	long long window = atomic_load_explicit(&error_window, memory_order_relaxed);
+	if(window != second && atomic_compare_exchange_strong(&error_window, &window, second)) {
+		atomic_store_explicit(&error_count, 0, memory_order_relaxed);
+	}
+	if(atomic_fetch_add_explicit(&error_count, 1, memory_order_relaxed) < limit) return 1;
+
+	atomic_fetch_add_explicit(&error_suppressed, 1, memory_order_relaxed);
+	return 0;
+}
+
+static COLD void emit_error(enum rstatus status, const char* format, ...) {
+	if(!admit_error()) return;
+
+	char message[512];
+	va_list args;
+	va_start(args, format);
+	int length = vsnprintf(message, sizeof(message), format, args);
+	va_end(args);
+
+	unsigned long suppressed = atomic_exchange_explicit(&error_suppressed, 0, memory_order_relaxed);
+	if(suppressed && length >= 0 && (size_t)length < sizeof(message)) {
+		snprintf(message + length, sizeof(message) - length, " (%lu more errors suppressed)", suppressed);
+	}
+	atomic_load(&error_handler)(status, message, atomic_load(&error_context));
+}
+
+// readable_number ends at `end`, or at its NUL if end is NULL.
+static COLD void report_error(enum rstatus status, const struct number* n, const char* readable_number, const char* end, const char* type) {
+	char found[2], in_use[2];
+	int length = (int)(end ? (size_t)(end - readable_number) : strlen(readable_number));
+	switch(status) {
+	case RSTATUS_OK:
+	case RSTATUS_IO_ERROR:
+	case RSTATUS_INVALID_ARGUMENT:
+	case RSTATUS_INEXACT:
+	break;
+	case RSTATUS_EMPTY:
+		emit_error(status, "[CREADABLE ERROR] No number provided. Defaulting to zero.");
+	break;
+	case RSTATUS_INVALID_SYMBOL:
+		emit_error(status, "[CREADABLE ERROR] Invalid symbol found: '%c'. Defaulting to zero.", *n->error_at);
+	break;
+	case RSTATUS_SEPARATOR_MISMATCH:
+		emit_error(
+			status,
+			"[CREADABLE ERROR] Incosistent usage of separators: "
+			"found '%s' while '%s' already in use. Defaulting to zero.",
+			separator_name(*n->error_at, found),
+			separator_name(n->separator, in_use)
+		);
+	break;
+	case RSTATUS_MISPLACED_SYMBOL:
+		emit_error(status, "[CREADABLE ERROR] Incorrect usage of '%c' symbol. Defaulting to zero.", *n->error_at);
+	break;
+	case RSTATUS_MISSING_EXPONENT:
+		emit_error(status, "[CREADABLE ERROR] Missing exponent after '%c' symbol. Defaulting to zero.", *n->error_at);
+	break;
+	case RSTATUS_OVERFLOW:
+		emit_error(status, "[CREADABLE ERROR] %.*s overflows %s type. Defaulting to zero.", length, readable_number, type);
+	break;
+	case RSTATUS_UNDERFLOW:
+		emit_error(status, "[CREADABLE ERROR] %.*s underflows %s type. Defaulting to zero.", length, readable_number, type);
+	break;
+	case RSTATUS_NEGATIVE_UNSIGNED:
+		emit_error(status, "[CREADABLE ERROR] Cannot assign negative number to unsigned type. Defaulting to zero.");
+	break;
+	case RSTATUS_FLOAT_TO_INTEGER:
+		emit_error(status, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.");
+	break;
+	case RSTATUS_INTEGER_TO_FLOAT:
+		emit_error(status, "[CREADABLE ERROR] Cannot assign integer number to floating point type. Defaulting to zero.");
+	break;
+	}
+}
+
+// Converts eight ASCII digits at once (SWAR): neighbouring digits are
+// combined into two-digit, then four-digit, then eight-digit values
+// inside a single 64-bit word.
+static unsigned long long parse_eight_digits(const char* digits) {
+	uint64_t chunk;
+	memcpy(&chunk, digits, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	chunk = __builtin_bswap64(chunk);
+#endif
+	chunk -= 0x3030303030303030ULL;
+	chunk = chunk*10 + (chunk >> 8);
+	chunk = (((chunk & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+		(((chunk >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+	return chunk;
+}
+
+// ===========================
+// CPU dispatch
+// ===========================
+
+// The innermost loops come in one variant per instruction set: sorting the
+// bytes of a number by kind (rvalidate), measuring a run of digits
+// (extract_number), turning up to 19 digits into their value (the integer
+// and floating point conversions) and finding a delimiter (rindex_fields). The best set the CPU runs is
+// picked once when the library is loaded; CREADABLE_SIMD=scalar, sse2, avx2
+// or avx512 in the environment caps it, so that every variant can be
+// tested and timed on the same machine.
+// Bit i of each mask is set when byte i is of that kind.
+struct byte_masks {
+	uint64_t digit;
+	uint64_t underscore;
+	uint64_t comma;
+	uint64_t space;
+	uint64_t tab;
+	uint64_t point;
+	uint64_t exponent;
+	uint64_t minus;
+	uint64_t plus;
+};
+
+struct kernels {
+	const char* name;
+	// masks of the first length bytes of a 64-byte, NUL padded block
+	void (*classify)(const char bytes[64], size_t length, struct byte_masks* m);
+	// digits from p on, up to end or to the terminating NUL if end is NULL
+	size_t (*digit_run)(const char* p, const char* end);
+	// value of 16 <= count <= 19 digits
+	unsigned long long (*digits_value)(const char* digits, size_t count);
+	// bit i set when bytes[i] == c
+	uint64_t (*match)(const char bytes[64], char c);
+};
+
+static void classify_scalar(const char bytes[64], size_t length, struct byte_masks* m) {
+	*m = (struct byte_masks){0, 0, 0, 0, 0, 0, 0, 0, 0};
+	for(int i = 0; i < (int)length; ++i) {
+		uint64_t bit = 1ULL << i;
+		switch(bytes[i]) {
+		case '0': case '1': case '2': case '3': case '4':
+		case '5': case '6': case '7': case '8': case '9':
+			m->digit |= bit;
+		break;
+		case '_': m->underscore |= bit; break;
+		case ',': m->comma |= bit; break;
+		case ' ': m->space |= bit; break;
+		case '\t': m->tab |= bit; break;
+		case '.': m->point |= bit; break;
+		case 'e': case 'E': m->exponent |= bit; break;
+		case '-': m->minus |= bit; break;
+		case '+': m->plus |= bit; break;
+		default: break;
+		}
+	}
+}
+
+static size_t digit_run_scalar(const char* p, const char* end) {
+	const char* start = p;
+	while(p != end && *p >= '0' && *p <= '9') ++p;
+	return (size_t)(p - start);
+}
+
+static unsigned long long digits_value_scalar(const char* digits, size_t count) {
+	size_t i = 0;
+	unsigned long long value = 0;
+	for(; i < count % 8; ++i) {
+		value = value*10 + (unsigned)(digits[i] - '0');
+	}
+	for(; i < count; i += 8) {
+		value = value*100000000 + parse_eight_digits(digits + i);
+	}
+	return value;
+}
+
+static uint64_t match_scalar(const char bytes[64], char c) {
+	uint64_t m = 0;
+	for(int i = 0; i < 64; ++i) m |= (uint64_t)(bytes[i] == c) << i;
+	return m;
+}
+
+static const struct kernels scalar_kernels = {"scalar", classify_scalar, digit_run_scalar, digits_value_scalar, match_scalar};
+
+#ifdef CREADABLE_X86
+
+// A block that does not cross a page boundary cannot fault, so the NUL-
+// terminated digit_run reads whole blocks up to the end of the page even
+// past the NUL. That is still out of bounds as far as C is concerned and
+// sanitizers rightly report it, so their builds scan such input byte by byte.
+#if defined(__SANITIZE_ADDRESS__) || defined(__SANITIZE_HWADDRESS__)
+#define CREADABLE_PAGE_READS 0
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer) || __has_feature(hwaddress_sanitizer) || __has_feature(memory_sanitizer)
+#define CREADABLE_PAGE_READS 0
+#endif
+#endif
+#ifndef CREADABLE_PAGE_READS
+#define CREADABLE_PAGE_READS 1
+#endif
+
+// One classify, digit_run and match per vector width, over blocks of WIDTH
+// bytes: LOAD reads one, EQ and DIGITS give the matching bytes as a vector
+// that MASK turns into bits (AVX-512 compares straight into bits).
+#define KERNELS(name, isa, WIDTH, vector, LOAD, EQ, OR, DIGITS, MASK) \
+	__attribute__((target(isa))) \
+	static void classify_##name(const char bytes[64], size_t length, struct byte_masks* m) { \
+		*m = (struct byte_masks){0, 0, 0, 0, 0, 0, 0, 0, 0}; \
+		for(int i = 0; i < (int)length; i += WIDTH) { \
+			vector v = LOAD(bytes + i); \
+			m->digit |= MASK(DIGITS(v)) << i; \
+			m->underscore |= MASK(EQ(v, '_')) << i; \
+			m->comma |= MASK(EQ(v, ',')) << i; \
+			m->space |= MASK(EQ(v, ' ')) << i; \
+			m->tab |= MASK(EQ(v, '\t')) << i; \
+			m->point |= MASK(EQ(v, '.')) << i; \
+			m->exponent |= MASK(OR(EQ(v, 'e'), EQ(v, 'E'))) << i; \
+			m->minus |= MASK(EQ(v, '-')) << i; \
+			m->plus |= MASK(EQ(v, '+')) << i; \
+		} \
+	} \
+	\
+	/* whole blocks only where they stay inside the input; a NUL-terminated */ \
+	/* one has no known end, see CREADABLE_PAGE_READS */ \
+	__attribute__((target(isa))) \
+	static size_t digit_run_##name(const char* p, const char* end) { \
+		const char* start = p; \
+		while(end ? end - p >= WIDTH : CREADABLE_PAGE_READS && ((uintptr_t)p & 4095) <= 4096 - WIDTH) { \
+			uint64_t digits = MASK(DIGITS(LOAD(p))); \
+			if(~digits << (64 - WIDTH)) return (size_t)(p - start) + (size_t)__builtin_ctzll(~digits); \
+			p += WIDTH; \
+		} \
+		while(p != end && *p >= '0' && *p <= '9') ++p; \
+		return (size_t)(p - start); \
+	} \
+	\
+	__attribute__((target(isa))) \
+	static uint64_t match_##name(const char bytes[64], char c) { \
+		uint64_t m = 0; \
+		for(int i = 0; i < 64; i += WIDTH) m |= MASK(EQ(LOAD(bytes + i), c)) << i; \
+		return m; \
+	}
+
+// unsigned v - '0' <= 9
+#define SSE2_DIGITS(v) _mm_cmpeq_epi8(_mm_min_epu8(_mm_sub_epi8((v), _mm_set1_epi8('0')), _mm_set1_epi8(9)), _mm_sub_epi8((v), _mm_set1_epi8('0')))
+#define SSE2_LOAD(p) _mm_loadu_si128((const __m128i*)(p))
+#define SSE2_EQ(v, c) _mm_cmpeq_epi8((v), _mm_set1_epi8(c))
+#define SSE2_MASK(v) ((uint64_t)(uint16_t)_mm_movemask_epi8(v))
+KERNELS(sse2, "sse2", 16, __m128i, SSE2_LOAD, SSE2_EQ, _mm_or_si128, SSE2_DIGITS, SSE2_MASK)
+
+#define AVX2_DIGITS(v) _mm256_cmpeq_epi8(_mm256_min_epu8(_mm256_sub_epi8((v), _mm256_set1_epi8('0')), _mm256_set1_epi8(9)), _mm256_sub_epi8((v), _mm256_set1_epi8('0')))
+#define AVX2_LOAD(p) _mm256_loadu_si256((const __m256i*)(p))
+#define AVX2_EQ(v, c) _mm256_cmpeq_epi8((v), _mm256_set1_epi8(c))
+#define AVX2_MASK(v) ((uint64_t)(uint32_t)_mm256_movemask_epi8(v))
+KERNELS(avx2, "avx2", 32, __m256i, AVX2_LOAD, AVX2_EQ, _mm256_or_si256, AVX2_DIGITS, AVX2_MASK)
+
+#define AVX512_DIGITS(v) _mm512_cmple_epu8_mask(_mm512_sub_epi8((v), _mm512_set1_epi8('0')), _mm512_set1_epi8(9))
+#define AVX512_LOAD(p) _mm512_loadu_si512((const void*)(p))
+#define AVX512_EQ(v, c) _mm512_cmpeq_epi8_mask((v), _mm512_set1_epi8(c))
+#define AVX512_OR(a, b) ((a) | (b))
+#define AVX512_MASK(bits) ((uint64_t)(bits))
+KERNELS(avx512, "avx512f,avx512bw", 64, __m512i, AVX512_LOAD, AVX512_EQ, AVX512_OR, AVX512_DIGITS, AVX512_MASK)
+
+// Sixteen digits in one register: neighbouring digits are multiplied and
+// added into pairs, pairs into quadruples and quadruples into the two
+// eight-digit halves. SSSE3 does the first step on bytes, SSE2 has to
+// widen them to 16 bits first.
+__attribute__((target("sse2")))
+static unsigned long long sixteen_digits_sse2(const char* digits) {
+	__m128i v = _mm_sub_epi8(_mm_loadu_si128((const __m128i*)digits), _mm_set1_epi8('0'));
+	__m128i tens = _mm_set_epi16(1, 10, 1, 10, 1, 10, 1, 10);
+	__m128i low = _mm_madd_epi16(_mm_unpacklo_epi8(v, _mm_setzero_si128()), tens);
+	__m128i high = _mm_madd_epi16(_mm_unpackhi_epi8(v, _mm_setzero_si128()), tens);
+	__m128i pairs = _mm_packs_epi32(low, high);
+	__m128i quads = _mm_madd_epi16(pairs, _mm_set_epi16(1, 100, 1, 100, 1, 100, 1, 100));
+	quads = _mm_packs_epi32(quads, quads);
+	__m128i eights = _mm_madd_epi16(quads, _mm_set_epi16(1, 10000, 1, 10000, 1, 10000, 1, 10000));
+	return (unsigned long long)(uint32_t)_mm_cvtsi128_si32(eights)*100000000 +
+		(uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(eights, 4));
+}
+
+__attribute__((target("avx2")))
+static unsigned long long sixteen_digits_avx2(const char* digits) {
+	__m128i v = _mm_sub_epi8(_mm_loadu_si128((const __m128i*)digits), _mm_set1_epi8('0'));
+	__m128i pairs = _mm_maddubs_epi16(v, _mm_set_epi8(1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10));
+	__m128i quads = _mm_madd_epi16(pairs, _mm_set_epi16(1, 100, 1, 100, 1, 100, 1, 100));
+	quads = _mm_packus_epi32(quads, quads);
+	__m128i eights = _mm_madd_epi16(quads, _mm_set_epi16(1, 10000, 1, 10000, 1, 10000, 1, 10000));
+	return (unsigned long long)(uint32_t)_mm_cvtsi128_si32(eights)*100000000 +
+		(uint32_t)_mm_cvtsi128_si32(_mm_srli_si128(eights, 4));
+}
+
+// The last sixteen digits in one go, the (at most three) before them one
+// at a time.
+#define DIGITS_VALUE(name, isa) \
+	__attribute__((target(isa))) \
+	static unsigned long long digits_value_##name(const char* digits, size_t count) { \
+		unsigned long long value = 0; \
+		for(size_t i = 0; i < count - 16; ++i) value = value*10 + (unsigned)(digits[i] - '0'); \
+		return value*10000000000000000ULL + sixteen_digits_##name(digits + count - 16); \
+	}
+
+DIGITS_VALUE(sse2, "sse2")
+DIGITS_VALUE(avx2, "avx2")
+
+static const struct kernels sse2_kernels = {"sse2", classify_sse2, digit_run_sse2, digits_value_sse2, match_sse2};
+static const struct kernels avx2_kernels = {"avx2", classify_avx2, digit_run_avx2, digits_value_avx2, match_avx2};
+static const struct kernels avx512_kernels = {"avx512", classify_avx512, digit_run_avx512, digits_value_avx2, match_avx512};
+
+#endif
+
+static const struct kernels* kernels = &scalar_kernels;
+
+#ifdef CREADABLE_X86
+__attribute__((constructor))
+static void select_kernels(void) {
+	// best first
+	static const struct kernels* const levels[] = {&avx512_kernels, &avx2_kernels, &sse2_kernels, &scalar_kernels};
+	__builtin_cpu_init();
+	int supported[] = {
+		__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"),
+		__builtin_cpu_supports("avx2"),
+		__builtin_cpu_supports("sse2"),
+		1
+	};
+
+	// an unknown name leaves the choice to the CPU
+	const char* forced = getenv("CREADABLE_SIMD");
+	size_t first = 0;
+	for(size_t i = 0; forced && i < sizeof(levels)/sizeof(levels[0]); ++i) {
+		if(!strcmp(forced, levels[i]->name)) first = i;
+	}
+	for(size_t i = first; i < sizeof(levels)/sizeof(levels[0]); ++i) {
+		if(supported[i]) {
+			kernels = levels[i];
+			return;
+		}
+	}
+}
+#endif
+
+CREADABLE_API const char* rsimd_level(void) {
+	return kernels->name;
+}
+
+// Short runs, by far the most common, are not worth an indirect call: the
+// kernels only see runs longer than 8 digits and values of 16 digits or more.
+static inline size_t digit_run(const char* p, const char* end) {
+	size_t run = 0;
+	while(run < 8 && p + run != end && p[run] >= '0' && p[run] <= '9') ++run;
+	if(run == 8) run += kernels->digit_run(p + 8, end);
+	return run;
+}
+
+// value of count <= 19 digits
+static inline unsigned long long digits_value(const char* digits, size_t count) {
+	return count < 16 ? digits_value_scalar(digits, count) : kernels->digits_value(digits, count);
+}
+
+// Turns the separator-free significant digits into the integer magnitude.
+// Up to 19 digits always fit in 64 bits, so the only overflow check needed
+// is on the last digit of a 20 digit number.
+static void convert_integer(struct number* n) {
+	if(n->ndigits > 20) {
+		n->overflow = 1;
+		return;
+	}
+
+	if(n->ndigits < 20) {
+		n->value = digits_value(n->digits, n->ndigits);
+		return;
+	}
+	unsigned long long value = digits_value(n->digits, 19);
+	unsigned last = (unsigned)(n->digits[19] - '0');
+	if(value > (ULLONG_MAX - last)/10) {
+		n->overflow = 1;
+		return;
+	}
+	n->value = value*10 + last;
+}
+
+// What each byte can be in a number, looked up in struct rparser's table
+// so the scanners take a single load per byte whatever the configuration.
+enum char_class {
+	CLASS_OTHER,         // cannot appear in a number
+	CLASS_END,           // the terminating NUL
+	CLASS_DIGIT,
+	CLASS_SEPARATOR,
+	CLASS_SPACE,         // whitespace separator, only checked once something follows it
+	CLASS_BLANK,         // whitespace that is not a separator, only allowed around the number
+	CLASS_POINT,
+	CLASS_EXPONENT,
+	CLASS_MINUS,
+	CLASS_PLUS,          // leading '+' allowed
+	CLASS_EXPONENT_PLUS  // '+' only allowed in the exponent
+};
+
+// '_', ',', space and tab as separators, '.' as decimal mark and no
+// leading '+': what rparser_init(parser, NULL, '\0', 0) builds.
+static const struct rparser default_parser = {{
+	['\0'] = CLASS_END,
+	['0'] = CLASS_DIGIT, ['1'] = CLASS_DIGIT, ['2'] = CLASS_DIGIT, ['3'] = CLASS_DIGIT, ['4'] = CLASS_DIGIT,
+	['5'] = CLASS_DIGIT, ['6'] = CLASS_DIGIT, ['7'] = CLASS_DIGIT, ['8'] = CLASS_DIGIT, ['9'] = CLASS_DIGIT,
+	['_'] = CLASS_SEPARATOR, [','] = CLASS_SEPARATOR,
+	[' '] = CLASS_SPACE, ['\t'] = CLASS_SPACE,
+	['.'] = CLASS_POINT,
+	['e'] = CLASS_EXPONENT, ['E'] = CLASS_EXPONENT,
+	['-'] = CLASS_MINUS,
+	['+'] = CLASS_EXPONENT_PLUS
+}};
+
+CREADABLE_API enum rstatus rparser_init(struct rparser* parser, const char* separators, char decimal_mark, unsigned flags) {
+	if(!separators) separators = "_, \t";
+	if(!decimal_mark) decimal_mark = '.';
+
+	// letters would clash with exponents, radix prefixes and hex digits
+	#define RESERVED(c) (((c) >= '0' && (c) <= '9') || ((c) >= 'a' && (c) <= 'z') || ((c) >= 'A' && (c) <= 'Z') || (c) == '+' || (c) == '-')
+	if(RESERVED(decimal_mark) || decimal_mark == ' ' || decimal_mark == '\t' || strchr(separators, decimal_mark)) {
+		emit_error(RSTATUS_INVALID_ARGUMENT, "[CREADABLE ERROR] '%c' cannot be used as decimal mark.", decimal_mark);
+		return RSTATUS_INVALID_ARGUMENT;
+	}
+	for(const char* s = separators; *s; ++s) {
+		if(RESERVED(*s)) {
+			emit_error(RSTATUS_INVALID_ARGUMENT, "[CREADABLE ERROR] '%c' cannot be used as separator.", *s);
+			return RSTATUS_INVALID_ARGUMENT;
+		}
+	}
+	#undef RESERVED
+
+	memset(parser->classes, CLASS_OTHER, sizeof(parser->classes));
+	parser->classes['\0'] = CLASS_END;
+	for(int c = '0'; c <= '9'; ++c) parser->classes[c] = CLASS_DIGIT;
+	parser->classes[' '] = CLASS_BLANK;
+	parser->classes['\t'] = CLASS_BLANK;
+	for(const char* s = separators; *s; ++s) {
+		parser->classes[(unsigned char)*s] = *s == ' ' || *s == '\t' ? CLASS_SPACE : CLASS_SEPARATOR;
+	}
+	parser->classes[(unsigned char)decimal_mark] = CLASS_POINT;
+	parser->classes['e'] = CLASS_EXPONENT;
+	parser->classes['E'] = CLASS_EXPONENT;
+	parser->classes['-'] = CLASS_MINUS;
+	parser->classes['+'] = flags & RPARSER_PLUS_SIGN ? CLASS_PLUS : CLASS_EXPONENT_PLUS;
+	return RSTATUS_OK;
+}
+
+// Digit values for every byte, NO for bytes that are not a digit in any
+// supported base. A digit belongs to a base when its value is below it.
+#define NO 0xFF
+static const unsigned char digit_values[256] = {
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	0, 1, 2, 3, 4, 5, 6, 7, 8, 9, NO, NO, NO, NO, NO, NO,
+	NO, 10, 11, 12, 13, 14, 15, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, 10, 11, 12, 13, 14, 15, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+	NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO, NO,
+};
+#undef NO
+
+// Packs eight digit values of `bits` bits each (SWAR): neighbouring digits
+// are merged into pairs, then quadruples, then the whole group inside a
+// single 64-bit word, like parse_eight_digits does for decimal.
+static unsigned long long pack_eight_digits(const char* digits, unsigned bits) {
+	uint64_t chunk;
+	memcpy(&chunk, digits, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	chunk = __builtin_bswap64(chunk);
+#endif
+	chunk = ((chunk << bits) + (chunk >> 8)) & 0x00FF00FF00FF00FFULL;
+	chunk = ((chunk << 2*bits) + (chunk >> 16)) & 0x0000FFFF0000FFFFULL;
+	chunk = ((chunk << 4*bits) + (chunk >> 32)) & 0x00000000FFFFFFFFULL;
+	return chunk;
+}
+
+// Turns the significant digit values into the magnitude, eight at a time,
+// overflowing as soon as a shift would push out a set bit.
+static void convert_radix(struct number* n, unsigned bits) {
+	size_t i = 0;
+	unsigned long long value = 0;
+	for(; i < n->ndigits % 8; ++i) {
+		if(value >> (64 - bits)) {
+			n->overflow = 1;
+			return;
+		}
+		value = value << bits | (unsigned char)n->digits[i];
+	}
+	for(; i < n->ndigits; i += 8) {
+		if(value >> (64 - 8*bits)) {
+			n->overflow = 1;
+			return;
+		}
+		value = value << 8*bits | pack_eight_digits(n->digits + i, bits);
+	}
+	n->value = value;
+}
+
+// The base announced by the letter after a leading zero: 0x, 0o or 0b.
+static unsigned radix_bits(char letter) {
+	switch(letter) {
+	case 'x':
+	case 'X':
+		return 4;
+	case 'o':
+	case 'O':
+		return 3;
+	case 'b':
+	case 'B':
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+// Digits of a prefixed integer, from just past the base letter at `prefix`
+// on. Follows the extract_number rules for separators, whitespace and
+// prefix mode; leading zeros are dropped and the digit values (not their
+// characters) are kept in n->digits.
+static enum rstatus extract_radix(const struct rparser* parser, const char* prefix, const char* end, const char** stop, struct number* n, unsigned bits) {
+	unsigned base = 1u << bits;
+	size_t total_digits = 0;
+	n->bits = (char)bits;
+	const char* whitespace = NULL;
+
+	#define FAIL(status, at) do { \
+		if(stop) goto stopped; \
+		n->error_at = (at); \
+		return (status); \
+	} while(0)
+	#define RADIX_DIGIT_AT(q) ((q) != end && digit_values[(unsigned char)*(q)] < base)
+
+	const char* p = prefix + 1;
+	for(; p != end; ++p) {
+		unsigned char class = parser->classes[(unsigned char)*p];
+		if(class == CLASS_SPACE || class == CLASS_BLANK) {
+			if(!whitespace) whitespace = p;
+			continue;
+		}
+		// a NUL only ends a number that has no explicit end
+		if(class == CLASS_END) {
+			if(!end) break;
+			FAIL(RSTATUS_INVALID_SYMBOL, p);
+		}
+		if(whitespace) {
+			if(stop && !RADIX_DIGIT_AT(p)) goto stopped;
+			for(const char* w = whitespace; w < p; ++w) {
+				if(parser->classes[(unsigned char)*w] == CLASS_BLANK) FAIL(RSTATUS_INVALID_SYMBOL, w);
+				enum rstatus status = use_separator(w, n);
+				if(status) FAIL(status, w);
+			}
+			whitespace = NULL;
+		}
+
+		if(digit_values[(unsigned char)*p] < base) {
+			// the whole run of digits at once, counted in locals since
+			// n->digits may alias n->ndigits
+			const char* run = p;
+			size_t ndigits = n->ndigits;
+			if(!ndigits) {
+				while(p != end && *p == '0') ++p;
+			}
+			unsigned digit;
+			for(; p != end && (digit = digit_values[(unsigned char)*p]) < base; ++p) {
+				// past 128 significant digits every type overflows in
+				// every base, the rest need not be kept
+				if(ndigits == 129) continue;
+				n->digits[ndigits++] = (char)digit;
+			}
+			total_digits += (size_t)(p - run);
+			n->ndigits = ndigits;
+			if(p == end) break;
+			--p;
+			continue;
+		}
+
+		switch(class) {
+		case CLASS_SEPARATOR:
+			if(stop && !RADIX_DIGIT_AT(p + 1)) goto stopped;
+			enum rstatus status = use_separator(p, n);
+			if(status) FAIL(status, p);
+		break;
+		case CLASS_MINUS:
+		case CLASS_PLUS:
+		case CLASS_EXPONENT_PLUS:
+		case CLASS_POINT:
+			FAIL(RSTATUS_MISPLACED_SYMBOL, p);
+		break;
+		default:
+			FAIL(RSTATUS_INVALID_SYMBOL, p);
+		break;
+		}
+	}
+	#undef RADIX_DIGIT_AT
+	#undef FAIL
+
+stopped:
+	if(stop) *stop = whitespace ? whitespace : p;
+	if(!total_digits) {
+		n->error_at = prefix;
+		return RSTATUS_MISPLACED_SYMBOL;
+	}
+	convert_radix(n, bits);
+	return RSTATUS_OK;
+}
+
+// Validates the readable number in a single pass over the input, gathering
+// its significant digits (separators stripped) in n->digits: no copy of the
+// string is made and nothing is allocated.
+// The number ends at the terminating NUL or at `end` if that is not NULL;
+// before `end` a NUL is an invalid symbol like any other.
+// Whitespace is only checked as a separator once something other than
+// whitespace follows it, which is how trailing spaces get ignored.
+// With `stop` set the number only has to be a prefix of the input: leading
+// whitespace is skipped, parsing ends without an error at the first
+// character that cannot continue the number and *stop points there. A
+// separator, the decimal mark or 'e' then only continues the number if a
+// digit follows.
+// Which byte is a separator, the decimal mark or a sign comes from the
+// parser's class table.
+static int digit_at(const char* p, const char* end) {
+	return p != end && *p >= '0' && *p <= '9';
+}
+
+static enum rstatus extract_number(const struct rparser* parser, const char* rn, const char* end, const char** stop, struct number* n) {
+	n->value = 0;
+	n->overflow = 0;
+	n->negative = 0;
+	n->floating = 0;
+	n->bits = 0;
+	n->exponent = 0;
+	n->ndigits = 0;
+	n->error_at = NULL;
+	n->separator = '\0';
+
+	char leading_spaces = 1;
+	char point = 0;
+	char sticky = 0; // a non-zero digit was dropped past CREADABLE_MAX_DIGITS
+	size_t total_digits = 0;
+	const char* whitespace = NULL; // start of the pending whitespace run
+
+	// scientific notation, e.g. 6.022_140_76e+23
+	const char* exponent_symbol = NULL;
+	char exponent_sign = 0;
+	size_t exponent_digits = 0;
+	long exponent = 0;
+
+	// in prefix mode an error only means the number ends there
+	#define FAIL(status, at) do { \
+		if(stop) goto stopped; \
+		n->error_at = (at); \
+		return (status); \
+	} while(0)
+
+	const char* p = rn;
+	if(stop) {
+		while(p != end && (*p == ' ' || *p == '\t')) ++p;
+	}
+	for(; p != end; ++p) {
+		unsigned char class = parser->classes[(unsigned char)*p];
+		if(class == CLASS_SPACE || class == CLASS_BLANK) {
+			if(!whitespace) whitespace = p;
+			continue;
+		}
+		// a NUL only ends a number that has no explicit end
+		if(class == CLASS_END) {
+			if(!end) break;
+			FAIL(RSTATUS_INVALID_SYMBOL, p);
+		}
+		if(whitespace) {
+			if(stop && class != CLASS_DIGIT) goto stopped;
+			for(const char* w = whitespace; w < p; ++w) {
+				if(parser->classes[(unsigned char)*w] == CLASS_BLANK) {
+					if(leading_spaces) continue;
+					FAIL(RSTATUS_INVALID_SYMBOL, w);
+				}
+				enum rstatus status = use_separator(w, n);
+				if(status) FAIL(status, w);
+			}
+			whitespace = NULL;
+		}
+
+		switch(class) {
+		case CLASS_MINUS:
+		case CLASS_PLUS:
+		case CLASS_EXPONENT_PLUS:
+			if(exponent_symbol && !exponent_sign && !exponent_digits) {
+				exponent_sign = *p;
+				break;
+			}
+			if(class == CLASS_EXPONENT_PLUS || !leading_spaces) FAIL(RSTATUS_MISPLACED_SYMBOL, p);
+			leading_spaces = 0;
+			if(class == CLASS_MINUS) n->negative = 1;
+		break;
+		case CLASS_DIGIT: {
+			unsigned digit = (unsigned)(*p - '0');
+			leading_spaces = 0;
+
+			// 0x, 0o or 0b in front of the first digit
+			if(!digit && !total_digits && !point && p + 1 != end) {
+				unsigned bits = radix_bits(p[1]);
+				if(bits && (!stop || (p + 2 != end && digit_values[(unsigned char)p[2]] < 1u << bits))) {
+					return extract_radix(parser, p + 1, end, stop, n, bits);
+				}
+			}
+
+			if(exponent_symbol) {
+				++exponent_digits;
+				// anything this large is already zero or infinity
+				if(exponent < 100000) exponent = exponent*10 + digit;
+				break;
+			}
+
+			// the whole run of digits at once, kept through a local since
+			// n->digits may alias n->ndigits; leading zeros only count for
+			// their position, digits past CREADABLE_MAX_DIGITS for theirs and
+			// for the sticky digit
+			const char* first = p;
+			const char* run_end = p + digit_run(p, end);
+			total_digits += (size_t)(run_end - p);
+			if(!n->ndigits) {
+				while(p != run_end && *p == '0') ++p;
+			}
+			char* out = n->digits + n->ndigits;
+			size_t room = CREADABLE_MAX_DIGITS - n->ndigits;
+			const char* kept_end = (size_t)(run_end - p) <= room ? run_end : p + room;
+			while(p != kept_end) *out++ = *p++;
+			n->ndigits = (size_t)(out - n->digits);
+			if(point) n->exponent -= (int)(kept_end - first);
+			else n->exponent += (int)(run_end - kept_end);
+			for(; p != run_end; ++p) {
+				if(*p != '0') sticky = 1;
+			}
+			--p;
+		}
+		break;
+		case CLASS_SEPARATOR:
+			if(stop && !digit_at(p + 1, end)) goto stopped;
+			leading_spaces = 0;
+			enum rstatus status = use_separator(p, n);
+			if(status) FAIL(status, p);
+		break;
+		case CLASS_POINT:
+			if(stop && !digit_at(p + 1, end)) goto stopped;
+			if(leading_spaces || point || exponent_symbol) FAIL(RSTATUS_MISPLACED_SYMBOL, p);
+			point = 1;
+			n->floating = 1;
+		break;
+		case CLASS_EXPONENT:
+			if(stop && !digit_at(p + 1, end) && !(p + 1 != end && (p[1] == '+' || p[1] == '-') && digit_at(p + 2, end))) goto stopped;
+			if(!total_digits || exponent_symbol) FAIL(RSTATUS_MISPLACED_SYMBOL, p);
+			exponent_symbol = p;
+			n->floating = 1;
+		break;
+		default:
+			FAIL(RSTATUS_INVALID_SYMBOL, p);
+		break;
+		}
+	}
+	#undef FAIL
+
+stopped:
+	if(stop) *stop = whitespace ? whitespace : p;
+	if(!total_digits) {
+		if(stop) *stop = rn;
+		return RSTATUS_EMPTY;
+	}
+	if(exponent_symbol && !exponent_digits) {
+		n->error_at = exponent_symbol;
+		return RSTATUS_MISSING_EXPONENT;
+	}
+	if(sticky) n->digits[n->ndigits++] = '1', --n->exponent;
+	n->exponent += (int)(exponent_sign == '-' ? -exponent : exponent);
+	if(!n->floating) convert_integer(n);
+	return RSTATUS_OK;
+}
+
+// Turns the kept digits into "<digits>e<exponent>" for the strto* family.
+static const char* float_digits(struct number* n) {
+	char* p = n->digits + n->ndigits;
+	if(!n->ndigits) *p++ = '0';
+	*p++ = 'e';
+
+	unsigned exponent = n->exponent < 0 ? 0u - (unsigned)n->exponent : (unsigned)n->exponent;
+	if(n->exponent < 0) *p++ = '-';
+	char reversed[16];
+	size_t len = 0;
+	do {
+		reversed[len++] = (char)('0' + exponent%10);
+		exponent /= 10;
+	} while(exponent);
+	while(len) *p++ = reversed[--len];
+	*p = '\0';
+
+	return n->digits;
+}
+
+// ===========================
+// Decimal to binary conversion
+// ===========================
+
+// Correctly rounded, locale independent conversion of the gathered digits
+// to float and double:
+//  1. Clinger's fast path when the digits and the power of ten are both
+//     exact in the target type, so a single multiplication or division
+//     rounds correctly;
+//  2. Eisel-Lemire otherwise: the first 19 digits are multiplied by a
+//     128-bit approximation of the power of ten;
+//  3. if digits were left out of those 19 and they change the result, the
+//     exact decimal is compared against the halfway point between the two
+//     candidates with big integer arithmetic.
+// long double keeps going through strtold, which never sees a decimal
+// point (see float_digits) and is therefore not locale sensitive either.
+#if FLT_RADIX == 2 && FLT_MANT_DIG == 24 && DBL_MANT_DIG == 53
+#define CREADABLE_BINARY_FLOATS
+#endif
+
+// The 128-bit product of a and b: the low word, the high one in *high.
+static uint64_t full_multiplication(uint64_t a, uint64_t b, uint64_t* high) {
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 product = (unsigned __int128)a * b;
+	*high = (uint64_t)(product >> 64);
+	return (uint64_t)product;
+#else
+	uint64_t a_lo = (uint32_t)a, a_hi = a >> 32;
+	uint64_t b_lo = (uint32_t)b, b_hi = b >> 32;
+	uint64_t lo_lo = a_lo*b_lo, hi_lo = a_hi*b_lo, lo_hi = a_lo*b_hi, hi_hi = a_hi*b_hi;
+	uint64_t cross = (lo_lo >> 32) + (uint32_t)hi_lo + lo_hi;
+	*high = hi_hi + (hi_lo >> 32) + (cross >> 32);
+	return (cross << 32) | (uint32_t)lo_lo;
+#endif
+}
+
+#ifdef CREADABLE_BINARY_FLOATS
+
+struct binary_format {
+	int mantissa_bits; // explicit bits, without the hidden one
+	int minimum_exponent;
+	int infinite_power;
+	int smallest_power_of_ten; // below this everything rounds to zero
+	int largest_power_of_ten; // above this everything rounds to infinity
+	int min_exponent_round_to_even;
+	int max_exponent_round_to_even;
+	int max_exponent_fast_path;
+	uint64_t max_mantissa_fast_path;
+};
+
+static const struct binary_format binary32 = {23, -127, 0xFF, -64, 38, -17, 10, 10, 1ULL << 24};
+static const struct binary_format binary64 = {52, -1023, 0x7FF, -342, 308, -4, 23, 22, 1ULL << 53};
+
+struct adjusted_mantissa {
+	uint64_t mantissa;
+	int power2; // biased exponent, 0 for subnormals and zero
+};
+
+static const double exact_powers_of_ten[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+#define SMALLEST_POWER_OF_FIVE -342
+
+// 128-bit truncated powers of five from 5^-342 to 5^324, normalised so the
+// most significant bit is set (two 64-bit words each, high word first).
+// Parsing stops at 5^308; the rest are for the shortest float formatting.
+static const uint64_t power_of_five_128[] = {
+	0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL,
+	0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL,
+	0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL,
+	0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL,
+	0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL,
+	0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL,
+	0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL,
+	0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL,
+	0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL,
+	0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL,
+	0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL,
+	0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL,
+	0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL,
+	0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL,
+	0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL,
+	0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL,
+	0x84A57695FE98746DULL, 0x014BB630F7604B57ULL,
+	0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL,
+	0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL,
+	0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL,
+	0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL,
+	0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL,
+	0xFD00B897478238D0ULL, 0x8920B098955522B4ULL,
+	0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL,
+	0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL,
+	0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL,
+	0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL,
+	0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL,
+	0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL,
+	0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL,
+	0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL,
+	0xEBA09271E88D976BULL, 0xF7864A44C633682EULL,
+	0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL,
+	0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL,
+	0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL,
+	0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL,
+	0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL,
+	0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL,
+	0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL,
+	0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL,
+	0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL,
+	0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL,
+	0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL,
+	0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL,
+	0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL,
+	0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL,
+	0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL,
+	0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL,
+	0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL,
+	0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL,
+	0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL,
+	0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL,
+	0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL,
+	0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL,
+	0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL,
+	0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL,
+	0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL,
+	0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL,
+	0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL,
+	0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL,
+	0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL,
+	0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL,
+	0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL,
+	0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL,
+	0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL,
+	0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL,
+	0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL,
+	0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL,
+	0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL,
+	0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL,
+	0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL,
+	0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL,
+	0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL,
+	0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL,
+	0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL,
+	0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL,
+	0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL,
+	0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL,
+	0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL,
+	0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL,
+	0xC987434744AC874EULL, 0xA327FFB266B56220ULL,
+	0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL,
+	0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL,
+	0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL,
+	0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL,
+	0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL,
+	0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL,
+	0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL,
+	0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL,
+	0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL,
+	0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL,
+	0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL,
+	0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL,
+	0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL,
+	0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL,
+	0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL,
+	0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL,
+	0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL,
+	0xAECC49914078536DULL, 0x58FAE9F773886E18ULL,
+	0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL,
+	0x888F99797A5E012DULL, 0x6D8406C952429603ULL,
+	0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL,
+	0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL,
+	0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL,
+	0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL,
+	0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL,
+	0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL,
+	0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL,
+	0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL,
+	0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL,
+	0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL,
+	0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL,
+	0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL,
+	0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL,
+	0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL,
+	0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL,
+	0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL,
+	0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL,
+	0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL,
+	0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL,
+	0xB913179899F68584ULL, 0x28E2557B59846E3FULL,
+	0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL,
+	0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL,
+	0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL,
+	0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL,
+	0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL,
+	0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL,
+	0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL,
+	0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL,
+	0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL,
+	0xD77485CB25823AC7ULL, 0x7D633293366B828BULL,
+	0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL,
+	0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL,
+	0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL,
+	0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL,
+	0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL,
+	0xCD795BE870516656ULL, 0x67902E276C921F8BULL,
+	0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL,
+	0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL,
+	0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL,
+	0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL,
+	0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL,
+	0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL,
+	0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL,
+	0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL,
+	0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL,
+	0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL,
+	0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL,
+	0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL,
+	0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL,
+	0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL,
+	0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL,
+	0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL,
+	0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL,
+	0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL,
+	0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL,
+	0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL,
+	0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL,
+	0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL,
+	0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL,
+	0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL,
+	0xD47487CC8470652BULL, 0x7647C3200069671FULL,
+	0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL,
+	0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL,
+	0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL,
+	0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL,
+	0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL,
+	0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL,
+	0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL,
+	0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL,
+	0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL,
+	0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL,
+	0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL,
+	0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL,
+	0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL,
+	0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL,
+	0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL,
+	0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL,
+	0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL,
+	0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL,
+	0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL,
+	0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL,
+	0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL,
+	0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL,
+	0x8C974F7383725573ULL, 0x1E414218C73A13FBULL,
+	0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL,
+	0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL,
+	0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL,
+	0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL,
+	0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL,
+	0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL,
+	0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL,
+	0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL,
+	0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL,
+	0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL,
+	0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL,
+	0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL,
+	0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL,
+	0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL,
+	0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL,
+	0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL,
+	0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL,
+	0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL,
+	0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL,
+	0xBE89523386091465ULL, 0xF6BBB397F1135823ULL,
+	0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL,
+	0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL,
+	0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL,
+	0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL,
+	0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL,
+	0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL,
+	0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL,
+	0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL,
+	0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL,
+	0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL,
+	0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL,
+	0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL,
+	0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL,
+	0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL,
+	0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL,
+	0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL,
+	0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL,
+	0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL,
+	0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL,
+	0x811CCC668829B887ULL, 0x0806357D5A3F525FULL,
+	0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL,
+	0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL,
+	0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL,
+	0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL,
+	0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL,
+	0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL,
+	0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL,
+	0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL,
+	0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL,
+	0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL,
+	0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL,
+	0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL,
+	0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL,
+	0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL,
+	0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL,
+	0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL,
+	0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL,
+	0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL,
+	0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL,
+	0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL,
+	0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL,
+	0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL,
+	0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL,
+	0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL,
+	0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL,
+	0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL,
+	0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL,
+	0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL,
+	0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL,
+	0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL,
+	0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL,
+	0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL,
+	0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL,
+	0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL,
+	0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL,
+	0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL,
+	0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL,
+	0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL,
+	0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL,
+	0xED246723473E3813ULL, 0x290123E9AAB23B68ULL,
+	0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL,
+	0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL,
+	0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL,
+	0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL,
+	0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL,
+	0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL,
+	0x8D590723948A535FULL, 0x579C487E5A38AD0EULL,
+	0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL,
+	0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL,
+	0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL,
+	0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL,
+	0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL,
+	0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL,
+	0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL,
+	0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL,
+	0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL,
+	0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL,
+	0xCDB02555653131B6ULL, 0x3792F412CB06794DULL,
+	0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL,
+	0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL,
+	0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL,
+	0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL,
+	0x9CED737BB6C4183DULL, 0x55464DD69685606BULL,
+	0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL,
+	0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL,
+	0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL,
+	0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL,
+	0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL,
+	0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL,
+	0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL,
+	0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL,
+	0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL,
+	0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL,
+	0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL,
+	0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL,
+	0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL,
+	0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL,
+	0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL,
+	0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL,
+	0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL,
+	0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL,
+	0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL,
+	0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL,
+	0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL,
+	0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL,
+	0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL,
+	0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL,
+	0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL,
+	0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL,
+	0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL,
+	0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL,
+	0xC612062576589DDAULL, 0x95364AFE032A819EULL,
+	0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL,
+	0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL,
+	0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL,
+	0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL,
+	0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL,
+	0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL,
+	0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL,
+	0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL,
+	0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL,
+	0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL,
+	0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL,
+	0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL,
+	0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL,
+	0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL,
+	0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL,
+	0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL,
+	0x89705F4136B4A597ULL, 0x31680A88F8953031ULL,
+	0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL,
+	0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL,
+	0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL,
+	0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL,
+	0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL,
+	0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL,
+	0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL,
+	0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL,
+	0x8000000000000000ULL, 0x0000000000000000ULL,
+	0xA000000000000000ULL, 0x0000000000000000ULL,
+	0xC800000000000000ULL, 0x0000000000000000ULL,
+	0xFA00000000000000ULL, 0x0000000000000000ULL,
+	0x9C40000000000000ULL, 0x0000000000000000ULL,
+	0xC350000000000000ULL, 0x0000000000000000ULL,
+	0xF424000000000000ULL, 0x0000000000000000ULL,
+	0x9896800000000000ULL, 0x0000000000000000ULL,
+	0xBEBC200000000000ULL, 0x0000000000000000ULL,
+	0xEE6B280000000000ULL, 0x0000000000000000ULL,
+	0x9502F90000000000ULL, 0x0000000000000000ULL,
+	0xBA43B74000000000ULL, 0x0000000000000000ULL,
+	0xE8D4A51000000000ULL, 0x0000000000000000ULL,
+	0x9184E72A00000000ULL, 0x0000000000000000ULL,
+	0xB5E620F480000000ULL, 0x0000000000000000ULL,
+	0xE35FA931A0000000ULL, 0x0000000000000000ULL,
+	0x8E1BC9BF04000000ULL, 0x0000000000000000ULL,
+	0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL,
+	0xDE0B6B3A76400000ULL, 0x0000000000000000ULL,
+	0x8AC7230489E80000ULL, 0x0000000000000000ULL,
+	0xAD78EBC5AC620000ULL, 0x0000000000000000ULL,
+	0xD8D726B7177A8000ULL, 0x0000000000000000ULL,
+	0x878678326EAC9000ULL, 0x0000000000000000ULL,
+	0xA968163F0A57B400ULL, 0x0000000000000000ULL,
+	0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL,
+	0x84595161401484A0ULL, 0x0000000000000000ULL,
+	0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL,
+	0xCECB8F27F4200F3AULL, 0x0000000000000000ULL,
+	0x813F3978F8940984ULL, 0x4000000000000000ULL,
+	0xA18F07D736B90BE5ULL, 0x5000000000000000ULL,
+	0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL,
+	0xFC6F7C4045812296ULL, 0x4D00000000000000ULL,
+	0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL,
+	0xC5371912364CE305ULL, 0x6C28000000000000ULL,
+	0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL,
+	0x9A130B963A6C115CULL, 0x3C7F400000000000ULL,
+	0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL,
+	0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL,
+	0x96769950B50D88F4ULL, 0x1314448000000000ULL,
+	0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL,
+	0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL,
+	0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL,
+	0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL,
+	0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL,
+	0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL,
+	0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL,
+	0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL,
+	0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL,
+	0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL,
+	0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL,
+	0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL,
+	0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL,
+	0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL,
+	0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL,
+	0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL,
+	0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL,
+	0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL,
+	0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL,
+	0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL,
+	0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL,
+	0x9F4F2726179A2245ULL, 0x01D762422C946590ULL,
+	0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL,
+	0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL,
+	0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL,
+	0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL,
+	0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL,
+	0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL,
+	0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL,
+	0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL,
+	0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL,
+	0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL,
+	0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL,
+	0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL,
+	0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL,
+	0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL,
+	0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL,
+	0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL,
+	0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL,
+	0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL,
+	0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL,
+	0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL,
+	0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL,
+	0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL,
+	0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL,
+	0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL,
+	0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL,
+	0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL,
+	0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL,
+	0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL,
+	0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL,
+	0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL,
+	0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL,
+	0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL,
+	0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL,
+	0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL,
+	0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL,
+	0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL,
+	0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL,
+	0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL,
+	0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL,
+	0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL,
+	0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL,
+	0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL,
+	0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL,
+	0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL,
+	0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL,
+	0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL,
+	0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL,
+	0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL,
+	0x884134FE908658B2ULL, 0x3109058D147FDCDDULL,
+	0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL,
+	0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL,
+	0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL,
+	0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL,
+	0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL,
+	0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL,
+	0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL,
+	0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL,
+	0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL,
+	0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL,
+	0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL,
+	0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL,
+	0x9AE757596946075FULL, 0x3375788DE9B06958ULL,
+	0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL,
+	0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL,
+	0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL,
+	0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL,
+	0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL,
+	0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL,
+	0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL,
+	0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL,
+	0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL,
+	0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL,
+	0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL,
+	0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL,
+	0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL,
+	0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL,
+	0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL,
+	0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL,
+	0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL,
+	0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL,
+	0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL,
+	0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL,
+	0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL,
+	0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL,
+	0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL,
+	0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL,
+	0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL,
+	0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL,
+	0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL,
+	0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL,
+	0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL,
+	0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL,
+	0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL,
+	0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL,
+	0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL,
+	0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL,
+	0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL,
+	0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL,
+	0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL,
+	0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL,
+	0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL,
+	0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL,
+	0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL,
+	0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL,
+	0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL,
+	0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL,
+	0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL,
+	0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL,
+	0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL,
+	0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL,
+	0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL,
+	0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL,
+	0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL,
+	0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL,
+	0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL,
+	0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL,
+	0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL,
+	0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL,
+	0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL,
+	0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL,
+	0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL,
+	0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL,
+	0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL,
+	0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL,
+	0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL,
+	0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL,
+	0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL,
+	0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL,
+	0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL,
+	0x8FA475791A569D10ULL, 0xF96E017D694487BCULL,
+	0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL,
+	0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL,
+	0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL,
+	0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL,
+	0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL,
+	0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL,
+	0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL,
+	0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL,
+	0x85C7056562757456ULL, 0xF6872D5667844E49ULL,
+	0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL,
+	0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL,
+	0x82A45B450226B39CULL, 0xECC0024661173473ULL,
+	0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL,
+	0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL,
+	0xFF290242C83396CEULL, 0x7E67047175A15271ULL,
+	0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL,
+	0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL,
+	0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL,
+	0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL,
+	0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL,
+	0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL,
+	0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL,
+	0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL,
+	0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL,
+	0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL,
+	0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL,
+	0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL,
+	0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL,
+	0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL,
+	0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL,
+	0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL,
+	0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL,
+	0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL,
+	0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL,
+	0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL,
+	0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL,
+	0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL,
+	0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL,
+	0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL,
+	0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL,
+	0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL,
+	0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL,
+	0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL,
+	0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL,
+	0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL,
+	0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL,
+	0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL,
+	0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL,
+	0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL,
+	0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL,
+	0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL,
+	0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL,
+	0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL,
+	0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL,
+	0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL,
+	0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL,
+	0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL,
+	0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL,
+	0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL,
+	0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL,
+	0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL,
+	0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL,
+	0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL,
+	0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL,
+	0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL,
+	0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL,
+	0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL,
+	0x8533285C936B35DEULL, 0xD53A88958F87275FULL,
+	0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL,
+	0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL,
+	0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL,
+	0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL,
+	0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL,
+	0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL,
+	0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL,
+	0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL,
+	0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL,
+	0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL,
+	0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL,
+	0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL,
+	0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL,
+	0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL,
+	0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL,
+	0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL,
+	0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL,
+	0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL,
+	0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL,
+	0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL,
+	0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL,
+	0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL,
+	0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL,
+	0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL,
+	0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL,
+	0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL,
+	0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL,
+	0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL,
+	0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL,
+	0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL,
+	0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL,
+	0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL,
+	0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL,
+	0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL,
+	0xA0555E361951C366ULL, 0xD7E105BCC332621FULL,
+	0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL,
+	0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL,
+	0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL,
+	0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL,
+	0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL,
+	0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL,
+	0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL,
+	0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL,
+	0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL,
+	0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL,
+	0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL,
+	0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL,
+	0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL,
+	0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL,
+	0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL,
+	0xB201833B35D63F73ULL, 0x2CD2CC6551E513DAULL,
+	0xDE81E40A034BCF4FULL, 0xF8077F7EA65E58D1ULL,
+	0x8B112E86420F6191ULL, 0xFB04AFAF27FAF782ULL,
+	0xADD57A27D29339F6ULL, 0x79C5DB9AF1F9B563ULL,
+	0xD94AD8B1C7380874ULL, 0x18375281AE7822BCULL,
+	0x87CEC76F1C830548ULL, 0x8F2293910D0B15B5ULL,
+	0xA9C2794AE3A3C69AULL, 0xB2EB3875504DDB22ULL,
+	0xD433179D9C8CB841ULL, 0x5FA60692A46151EBULL,
+	0x849FEEC281D7F328ULL, 0xDBC7C41BA6BCD333ULL,
+	0xA5C7EA73224DEFF3ULL, 0x12B9B522906C0800ULL,
+	0xCF39E50FEAE16BEFULL, 0xD768226B34870A00ULL,
+	0x81842F29F2CCE375ULL, 0xE6A1158300D46640ULL,
+	0xA1E53AF46F801C53ULL, 0x60495AE3C1097FD0ULL,
+	0xCA5E89B18B602368ULL, 0x385BB19CB14BDFC4ULL,
+	0xFCF62C1DEE382C42ULL, 0x46729E03DD9ED7B5ULL,
+	0x9E19DB92B4E31BA9ULL, 0x6C07A2C26A8346D1ULL,
+};
+
+static int leading_zeroes(uint64_t w) {
+#if defined(__GNUC__)
+	return __builtin_clzll(w);
+#else
+	int count = 0;
+	while(!(w & (1ULL << 63))) w <<= 1, ++count;
+	return count;
+#endif
+}
+
+// Eisel-Lemire: the correctly rounded value of w * 10^q, w being non-zero.
+static struct adjusted_mantissa compute_float(const struct binary_format* format, long q, uint64_t w) {
+	struct adjusted_mantissa answer = {0, 0};
+	if(q < format->smallest_power_of_ten) return answer;
+	if(q > format->largest_power_of_ten) {
+		answer.power2 = format->infinite_power;
+		return answer;
+	}
+
+	int lz = leading_zeroes(w);
+	w <<= lz;
+
+	// only as many bits as the rounding needs have to be right, so the
+	// second word of the power of five is rarely used
+	size_t index = 2*(size_t)(q - SMALLEST_POWER_OF_FIVE);
+	uint64_t precision_mask = UINT64_MAX >> (format->mantissa_bits + 3);
+	uint64_t high;
+	uint64_t low = full_multiplication(w, power_of_five_128[index], &high);
+	if((high & precision_mask) == precision_mask) {
+		uint64_t second_high;
+		full_multiplication(w, power_of_five_128[index + 1], &second_high);
+		low += second_high;
+		if(second_high > low) ++high;
+	}
+
+	int upperbit = (int)(high >> 63);
+	int shift = upperbit + 64 - format->mantissa_bits - 3;
+	answer.mantissa = high >> shift;
+	// floor(log2(10^q)) + 63, computed as in the reference implementation
+	long power = (((152170 + 65536)*q) >> 16) + 63;
+	answer.power2 = (int)(power + upperbit - lz - format->minimum_exponent);
+
+	if(answer.power2 <= 0) { // subnormal
+		if(-answer.power2 + 1 >= 64) {
+			answer.mantissa = 0;
+			answer.power2 = 0;
+			return answer;
+		}
+		answer.mantissa >>= -answer.power2 + 1;
+		answer.mantissa += answer.mantissa & 1;
+		answer.mantissa >>= 1;
+		answer.power2 = answer.mantissa < (1ULL << format->mantissa_bits) ? 0 : 1;
+		return answer;
+	}
+
+	// exactly halfway between two values: round to even
+	if(low <= 1 && q >= format->min_exponent_round_to_even && q <= format->max_exponent_round_to_even &&
+		(answer.mantissa & 3) == 1 && (answer.mantissa << shift) == high) {
+		answer.mantissa &= ~1ULL;
+	}
+	answer.mantissa += answer.mantissa & 1;
+	answer.mantissa >>= 1;
+	if(answer.mantissa >= (2ULL << format->mantissa_bits)) {
+		answer.mantissa = 1ULL << format->mantissa_bits;
+		++answer.power2;
+	}
+	answer.mantissa &= ~(1ULL << format->mantissa_bits);
+	if(answer.power2 >= format->infinite_power) {
+		answer.mantissa = 0;
+		answer.power2 = format->infinite_power;
+	}
+	return answer;
+}
+
+// Just enough of a big integer for the exact comparison: the largest
+// operand is the 769 significant digits shifted by about 1075 bits.
+#define BIGINT_LIMBS 144
+
+struct bigint {
+	uint32_t limb[BIGINT_LIMBS]; // least significant first
+	size_t len;
+};
+
+static void bigint_mul_add(struct bigint* b, uint32_t factor, uint32_t addend) {
+	uint64_t carry = addend;
+	for(size_t i = 0; i < b->len; ++i) {
+		uint64_t product = (uint64_t)b->limb[i]*factor + carry;
+		b->limb[i] = (uint32_t)product;
+		carry = product >> 32;
+	}
+	if(carry && b->len < BIGINT_LIMBS) b->limb[b->len++] = (uint32_t)carry;
+}
+
+static void bigint_mul_pow5(struct bigint* b, unsigned exponent) {
+	for(; exponent >= 13; exponent -= 13) bigint_mul_add(b, 1220703125u, 0); // 5^13
+	uint32_t rest = 1;
+	while(exponent--) rest *= 5;
+	bigint_mul_add(b, rest, 0);
+}
+
+static void bigint_shift_left(struct bigint* b, unsigned bits) {
+	if(!b->len) return;
+	size_t limbs = bits/32;
+	unsigned shift = bits%32;
+
+	size_t len = b->len + limbs + 1;
+	if(len > BIGINT_LIMBS) len = BIGINT_LIMBS;
+	for(size_t i = len; i-- > 0;) {
+		uint64_t word = 0;
+		if(i >= limbs && i - limbs < b->len) word = (uint64_t)b->limb[i - limbs] << shift;
+		if(shift && i >= limbs + 1 && i - limbs - 1 < b->len) word |= b->limb[i - limbs - 1] >> (32 - shift);
+		b->limb[i] = (uint32_t)word;
+	}
+	b->len = len;
+	while(b->len && !b->limb[b->len - 1]) --b->len;
+}
+
+static int bigint_compare(const struct bigint* a, const struct bigint* b) {
+	if(a->len != b->len) return a->len < b->len ? -1 : 1;
+	for(size_t i = a->len; i-- > 0;) {
+		if(a->limb[i] != b->limb[i]) return a->limb[i] < b->limb[i] ? -1 : 1;
+	}
+	return 0;
+}
+
+// Picks between `below` and the next representable value by comparing the
+// exact decimal digits * 10^exponent with the point halfway between them.
+static struct adjusted_mantissa round_exact(const struct binary_format* format, const struct number* n, struct adjusted_mantissa below) {
+	uint64_t m = below.mantissa;
+	int e = below.power2 + format->minimum_exponent - format->mantissa_bits;
+	if(below.power2) m |= 1ULL << format->mantissa_bits;
+	else ++e;
+	// halfway = (2m + 1) * 2^(e - 1)
+	uint64_t halfway_mantissa = 2*m + 1;
+	int halfway_exponent = e - 1;
+
+	struct bigint digits = {{0}, 0};
+	for(size_t i = 0; i < n->ndigits; ++i) {
+		bigint_mul_add(&digits, 10, (uint32_t)(n->digits[i] - '0'));
+	}
+	struct bigint halfway = {{(uint32_t)halfway_mantissa, (uint32_t)(halfway_mantissa >> 32)}, 2};
+	while(halfway.len && !halfway.limb[halfway.len - 1]) --halfway.len;
+
+	// compare digits * 5^q * 2^q with halfway_mantissa * 2^halfway_exponent,
+	// moving the powers of five and two to whichever side keeps them integer
+	long q = n->exponent;
+	if(q >= 0) bigint_mul_pow5(&digits, (unsigned)q);
+	else bigint_mul_pow5(&halfway, (unsigned)-q);
+	long binary_shift = q - halfway_exponent;
+	if(binary_shift > 0) bigint_shift_left(&digits, (unsigned)binary_shift);
+	else if(binary_shift < 0) bigint_shift_left(&halfway, (unsigned)-binary_shift);
+
+	int order = bigint_compare(&digits, &halfway);
+	if(order < 0 || (order == 0 && !(m & 1))) return below;
+
+	struct adjusted_mantissa above = below;
+	if(++above.mantissa == (1ULL << format->mantissa_bits)) {
+		// carried into the hidden bit (also turns the largest subnormal normal)
+		above.mantissa = 0;
+		++above.power2;
+	}
+	if(above.power2 >= format->infinite_power) {
+		above.mantissa = 0;
+		above.power2 = format->infinite_power;
+	}
+	return above;
+}
+
+static struct adjusted_mantissa decimal_to_binary(const struct binary_format* format, struct number* n) {
+	// trailing zeros only move the exponent
+	while(n->ndigits && n->digits[n->ndigits - 1] == '0') --n->ndigits, ++n->exponent;
+	if(!n->ndigits) return (struct adjusted_mantissa){0, 0};
+
+	size_t count = n->ndigits < 19 ? n->ndigits : 19;
+	uint64_t w = digits_value(n->digits, count);
+	long q = n->exponent + (long)(n->ndigits - count);
+
+	struct adjusted_mantissa answer = compute_float(format, q, w);
+	if(count == n->ndigits) return answer;
+
+	// the dropped digits put the value somewhere in [w, w+1) * 10^q
+	struct adjusted_mantissa upper = compute_float(format, q, w + 1);
+	if(answer.mantissa == upper.mantissa && answer.power2 == upper.power2) return answer;
+	return round_exact(format, n, answer);
+}
+
+// Clinger's fast path, w * 10^q with both operands exact.
+static int fast_path(const struct binary_format* format, const struct number* n, uint64_t* w, int* q) {
+#if FLT_EVAL_METHOD == 0
+	if(n->ndigits > 19 || n->exponent < -format->max_exponent_fast_path || n->exponent > format->max_exponent_fast_path) return 0;
+	*w = digits_value(n->digits, n->ndigits);
+	*q = n->exponent;
+	return *w <= format->max_mantissa_fast_path;
+#else
+	(void)format, (void)n, (void)w, (void)q;
+	return 0;
+#endif
+}
+
+static float to_float(struct number* n) {
+	uint64_t w;
+	int q;
+	if(fast_path(&binary32, n, &w, &q)) {
+		float ret = (float)w;
+		if(q < 0) ret /= (float)exact_powers_of_ten[-q];
+		else ret *= (float)exact_powers_of_ten[q];
+		return n->negative ? -ret : ret;
+	}
+
+	struct adjusted_mantissa am = decimal_to_binary(&binary32, n);
+	uint32_t bits = (uint32_t)am.mantissa | ((uint32_t)am.power2 << 23) | ((uint32_t)n->negative << 31);
+	float ret;
+	memcpy(&ret, &bits, sizeof(ret));
+	return ret;
+}
+
+static double to_double(struct number* n) {
+	uint64_t w;
+	int q;
+	if(fast_path(&binary64, n, &w, &q)) {
+		double ret = (double)w;
+		if(q < 0) ret /= exact_powers_of_ten[-q];
+		else ret *= exact_powers_of_ten[q];
+		return n->negative ? -ret : ret;
+	}
+
+	struct adjusted_mantissa am = decimal_to_binary(&binary64, n);
+	uint64_t bits = am.mantissa | ((uint64_t)am.power2 << 52) | ((uint64_t)n->negative << 63);
+	double ret;
+	memcpy(&ret, &bits, sizeof(ret));
+	return ret;
+}
+
+#else
+
+static float to_float(struct number* n) {
+	float ret = strtof(float_digits(n), NULL);
+	return n->negative ? -ret : ret;
+}
+
+static double to_double(struct number* n) {
+	double ret = strtod(float_digits(n), NULL);
+	return n->negative ? -ret : ret;
+}
+
+#endif
+
+// ===========================
+// Runtime statistics
+// ===========================
+
+// With CREADABLE_STATS every typed parser counts its calls, bytes and
+// outcomes, and with CREADABLE_STATS_CYCLES also how long each call took.
+// Each thread counts into its own shard, which only it writes, so counting
+// is a plain load and store with no lock and no shared cache line. Shards
+// of threads that exit are folded into stats_retired.
+// Without CREADABLE_STATS the hooks compile to nothing.
+static const char* const type_names[RTYPE_COUNT] = {
+	"char", "signed char", "unsigned char", "short", "unsigned short", "int", "unsigned int",
+	"long", "long long", "unsigned long", "unsigned long long", "float", "double", "long double"
+};
+
+static const char* const status_names[RSTATUS_COUNT] = {
+	"ok", "empty", "invalid_symbol", "separator_mismatch", "misplaced_symbol", "missing_exponent",
+	"overflow", "underflow", "negative_unsigned", "float_to_integer", "integer_to_float",
+	"io_error", "invalid_argument", "inexact"
+};
+
+#ifdef CREADABLE_STATS
+
+struct stats_counters {
+	atomic_ullong calls;
+	atomic_ullong bytes;
+	atomic_ullong statuses[RSTATUS_COUNT];
+	atomic_ullong cycles[RSTATS_BUCKETS];
+};
+
+struct stats_shard {
+	struct stats_counters types[RTYPE_COUNT];
+	struct stats_shard* next;
+};
+
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t stats_once = PTHREAD_ONCE_INIT;
+static pthread_key_t stats_key;
+static struct stats_shard* stats_shards = NULL; // threads still running
+static struct rstats stats_retired;
+static struct rstats stats_base; // totals at the last rstats_reset()
+
+static _Thread_local struct stats_shard stats_shard;
+static _Thread_local char stats_registered = 0;
+
+// only the owning thread writes, so no read-modify-write is needed
+static void stats_add(atomic_ullong* counter, unsigned long long amount) {
+	atomic_store_explicit(counter, atomic_load_explicit(counter, memory_order_relaxed) + amount, memory_order_relaxed);
+}
+
+static void stats_fold(struct rstats* into, const struct stats_shard* shard) {
+	for(int t = 0; t < RTYPE_COUNT; ++t) {
+		const struct stats_counters* from = &shard->types[t];
+		struct rstats_type* to = &into->types[t];
+		to->calls += atomic_load_explicit(&from->calls, memory_order_relaxed);
+		to->bytes += atomic_load_explicit(&from->bytes, memory_order_relaxed);
+		for(int s = 0; s < RSTATUS_COUNT; ++s) to->statuses[s] += atomic_load_explicit(&from->statuses[s], memory_order_relaxed);
+		for(int b = 0; b < RSTATS_BUCKETS; ++b) to->cycles[b] += atomic_load_explicit(&from->cycles[b], memory_order_relaxed);
+	}
+}
+
+static void stats_retire(void* shard) {
+	pthread_mutex_lock(&stats_lock);
+	stats_fold(&stats_retired, shard);
+	for(struct stats_shard** p = &stats_shards; *p; p = &(*p)->next) {
+		if(*p == shard) {
+			*p = ((struct stats_shard*)shard)->next;
+			break;
+		}
+	}
+	pthread_mutex_unlock(&stats_lock);
+}
+
+static void stats_create_key(void) {
+	pthread_key_create(&stats_key, stats_retire);
+}
+
+static COLD void stats_register(void) {
+	pthread_once(&stats_once, stats_create_key);
+	pthread_mutex_lock(&stats_lock);
+	stats_shard.next = stats_shards;
+	stats_shards = &stats_shard;
+	pthread_mutex_unlock(&stats_lock);
+	pthread_setspecific(stats_key, &stats_shard);
+	stats_registered = 1;
+}
+
+#ifdef CREADABLE_STATS_CYCLES
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+static unsigned long long stats_clock(void) {
+	return __rdtsc();
+}
+#else
+// nanoseconds where there is no cycle counter
+static unsigned long long stats_clock(void) {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (unsigned long long)ts.tv_sec*1000000000ULL + (unsigned long long)ts.tv_nsec;
+}
+#endif
+#define STATS_START() unsigned long long stats_started = stats_clock()
+#else
+#define STATS_START() unsigned long long stats_started = 0
+#endif
+
+static void stats_record(enum rtype type, const char* readable_number, const char* end, enum rstatus status, unsigned long long started) {
+	if(!stats_registered) stats_register();
+	struct stats_counters* counters = &stats_shard.types[type];
+	stats_add(&counters->calls, 1);
+	stats_add(&counters->bytes, end ? (size_t)(end - readable_number) : strlen(readable_number));
+	stats_add(&counters->statuses[status], 1);
+#ifdef CREADABLE_STATS_CYCLES
+	unsigned long long elapsed = stats_clock() - started;
+	int bucket = 0;
+	while(elapsed > 1 && bucket < RSTATS_BUCKETS - 1) {
+		elapsed >>= 1;
+		++bucket;
+	}
+	stats_add(&counters->cycles[bucket], 1);
+#else
+	(void)started;
+#endif
+}
+
+#define STATS_RECORD(tag, readable_number, end, status) stats_record(tag, readable_number, end, status, stats_started)
+
+static void stats_total(struct rstats* total) {
+	*total = stats_retired;
+	for(const struct stats_shard* shard = stats_shards; shard; shard = shard->next) stats_fold(total, shard);
+}
+
+CREADABLE_API void rstats_snapshot(struct rstats* stats) {
+	pthread_mutex_lock(&stats_lock);
+	stats_total(stats);
+	for(int t = 0; t < RTYPE_COUNT; ++t) {
+		struct rstats_type* now = &stats->types[t];
+		const struct rstats_type* base = &stats_base.types[t];
+		now->calls -= base->calls;
+		now->bytes -= base->bytes;
+		for(int s = 0; s < RSTATUS_COUNT; ++s) now->statuses[s] -= base->statuses[s];
+		for(int b = 0; b < RSTATS_BUCKETS; ++b) now->cycles[b] -= base->cycles[b];
+	}
+	pthread_mutex_unlock(&stats_lock);
+}
+
+// The shards are only ever written by their own thread, so resetting
+// remembers the current totals instead of clearing them.
+CREADABLE_API void rstats_reset(void) {
+	pthread_mutex_lock(&stats_lock);
+	stats_total(&stats_base);
+	pthread_mutex_unlock(&stats_lock);
+}
+
+#else
+
+#define STATS_START() ((void)0)
+#define STATS_RECORD(tag, readable_number, end, status) ((void)0)
+
+CREADABLE_API void rstats_snapshot(struct rstats* stats) {
+	memset(stats, 0, sizeof(*stats));
+}
+
+CREADABLE_API void rstats_reset(void) {
+}
+
+#endif
+
+CREADABLE_API void rstats_dump(FILE* out, const struct rstats* stats, enum rstats_format format) {
+	if(format == RSTATS_JSON) fprintf(out, "{");
+	int first = 1;
+	for(int t = 0; t < RTYPE_COUNT; ++t) {
+		const struct rstats_type* type = &stats->types[t];
+		if(!type->calls) continue;
+
+		if(format == RSTATS_JSON) {
+			fprintf(out, "%s\"%s\": {\"calls\": %llu, \"bytes\": %llu, \"statuses\": {", first ? "" : ", ", type_names[t], type->calls, type->bytes);
+			int first_status = 1;
+			for(int s = 0; s < RSTATUS_COUNT; ++s) {
+				if(!type->statuses[s]) continue;
+				fprintf(out, "%s\"%s\": %llu", first_status ? "" : ", ", status_names[s], type->statuses[s]);
+				first_status = 0;
+			}
+			fprintf(out, "}, \"cycles\": [");
+			for(int b = 0; b < RSTATS_BUCKETS; ++b) fprintf(out, "%s%llu", b ? ", " : "", type->cycles[b]);
+			fprintf(out, "]}");
+		}
+		else {
+			fprintf(out, "%s: %llu calls, %llu bytes, %llu errors", type_names[t], type->calls, type->bytes, type->calls - type->statuses[RSTATUS_OK]);
+			for(int s = 1; s < RSTATUS_COUNT; ++s) {
+				if(type->statuses[s]) fprintf(out, ", %s %llu", status_names[s], type->statuses[s]);
+			}
+			fprintf(out, "\n");
+			for(int b = 0; b < RSTATS_BUCKETS; ++b) {
+				if(type->cycles[b]) fprintf(out, "  < 2^%d cycles: %llu\n", b + 1, type->cycles[b]);
+			}
+		}
+		first = 0;
+	}
+	if(format == RSTATS_JSON) fprintf(out, "}\n");
+}
+
+// ===========================
+// Typed parsers
+// ===========================
+
+// Every integer type goes through one kernel: the scanner accumulates a
+// 64-bit magnitude and a sign, which is range checked once against the
+// limits of the destination type. Indexed by enum rtype.
+static const struct {
+	unsigned long long max;
+	unsigned long long min_magnitude; // 0 for unsigned types
+} integer_limits[] = {
+	{CHAR_MAX, (unsigned long long)-(CHAR_MIN+1) + 1},
+	{SCHAR_MAX, (unsigned long long)-(SCHAR_MIN+1) + 1},
+	{UCHAR_MAX, 0},
+	{SHRT_MAX, (unsigned long long)-(SHRT_MIN+1) + 1},
+	{USHRT_MAX, 0},
+	{INT_MAX, (unsigned long long)-(INT_MIN+1) + 1},
+	{UINT_MAX, 0},
+	{LONG_MAX, (unsigned long long)-(LONG_MIN+1) + 1},
+	{LLONG_MAX, (unsigned long long)-(LLONG_MIN+1) + 1},
+	{ULONG_MAX, 0},
+	{ULLONG_MAX, 0}
+};
+
+// What the scanner gathered in n, range checked against the limits of the
+// destination type. On success *out holds the value as a two's complement
+// long long for signed types (so it always fits the destination) and as
+// the plain magnitude for unsigned ones.
+static enum rstatus integer_value(const struct number* n, enum rtype type, unsigned long long* out) {
+	*out = 0;
+	if(n->negative && !integer_limits[type].min_magnitude) return RSTATUS_NEGATIVE_UNSIGNED;
+	if(n->floating) return RSTATUS_FLOAT_TO_INTEGER;
+
+	if(n->negative) {
+		// compare against -(MIN+1)+1 so the magnitude of MIN never has to fit the signed type
+		if(n->overflow || n->value > integer_limits[type].min_magnitude) return RSTATUS_UNDERFLOW;
+		*out = n->value ? (unsigned long long)(-(long long)(n->value - 1) - 1) : 0;
+		return RSTATUS_OK;
+	}
+	if(n->overflow || n->value > integer_limits[type].max) return RSTATUS_OVERFLOW;
+	*out = n->value;
+	return RSTATUS_OK;
+}
+
+// Every type has a convert_<name>() turning a scanned number into a value,
+// which parse_<name>() runs after extract_number and the stream parser
+// after its own scan.
+#define PARSER(name, type, tag) \
+	static enum rstatus parse_##name(const struct rparser* parser, const char* readable_number, const char* end, const char** stop, struct number* n, type* out) { \
+		STATS_START(); \
+		enum rstatus status = extract_number(parser, readable_number, end, stop, n); \
+		if(status) *out = 0; \
+		else status = convert_##name(n, out); \
+		STATS_RECORD(tag, readable_number, stop ? *stop : end, status); \
+		return status; \
+	}
+
+// unsigned long long -> long long is only taken for values produced by
+// integer_value, which are in range of the destination type
+#define SIGNED(name, type, tag) \
+	static enum rstatus convert_##name(struct number* n, type* out) { \
+		unsigned long long value; \
+		enum rstatus status = integer_value(n, tag, &value); \
+		*out = (type)(value > LLONG_MAX ? -(long long)(ULLONG_MAX - value) - 1 : (long long)value); \
+		return status; \
+	} \
+	PARSER(name, type, tag)
+
+#define UNSIGNED(name, type, tag) \
+	static enum rstatus convert_##name(struct number* n, type* out) { \
+		unsigned long long value; \
+		enum rstatus status = integer_value(n, tag, &value); \
+		*out = (type)value; \
+		return status; \
+	} \
+	PARSER(name, type, tag)
+
+SIGNED(char, char, RTYPE_CHAR)
+SIGNED(schar, signed char, RTYPE_SCHAR)
+UNSIGNED(uchar, unsigned char, RTYPE_UCHAR)
+
+SIGNED(short, short, RTYPE_SHORT)
+UNSIGNED(ushort, unsigned short, RTYPE_USHORT)
+
+SIGNED(int, int, RTYPE_INT)
+UNSIGNED(uint, unsigned int, RTYPE_UINT)
+
+SIGNED(long, long, RTYPE_LONG)
+SIGNED(longlong, long long, RTYPE_LONGLONG)
+UNSIGNED(ulong, unsigned long, RTYPE_ULONG)
+UNSIGNED(ulonglong, unsigned long long, RTYPE_ULONGLONG)
+
+#ifdef __SIZEOF_INT128__
+
+// The 128-bit magnitude of the gathered digits, 0 if it does not fit.
+// Decimal numbers are split into 19-digit runs from the right, each one
+// converted with 64-bit arithmetic, so up to 38 digits take a single
+// 64x64->128 multiply; only a 39th digit needs a third run and a check.
+static int convert_integer128(const struct number* n, unsigned __int128* out) {
+	if(n->bits) {
+		unsigned __int128 value = 0;
+		for(size_t i = 0; i < n->ndigits; ++i) {
+			if(value >> (128 - n->bits)) return 0;
+			value = value << n->bits | (unsigned char)n->digits[i];
+		}
+		*out = value;
+		return 1;
+	}
+
+	const unsigned long long ten19 = 10000000000000000000ULL;
+	if(n->ndigits > 39) return 0;
+	if(n->ndigits <= 19) {
+		*out = digits_value(n->digits, n->ndigits);
+		return 1;
+	}
+	size_t high = n->ndigits - 19;
+	if(high <= 19) {
+		*out = (unsigned __int128)digits_value(n->digits, high)*ten19 + digits_value(n->digits + high, 19);
+		return 1;
+	}
+	// 39 digits: 3.4e38 is the limit
+	unsigned __int128 top = (unsigned __int128)(unsigned)(n->digits[0] - '0')*ten19 + digits_value(n->digits + 1, 19);
+	unsigned long long low = digits_value(n->digits + 20, 19);
+	if(top > (~(unsigned __int128)0 - low)/ten19) return 0;
+	*out = top*ten19 + low;
+	return 1;
+}
+
+static enum rstatus parse_integer128(const struct rparser* parser, const char* readable_number, const char* end, const char** stop, struct number* n, int is_signed, unsigned __int128* out) {
+	*out = 0;
+	enum rstatus status = extract_number(parser, readable_number, end, stop, n);
+	if(status) return status;
+	if(n->negative && !is_signed) return RSTATUS_NEGATIVE_UNSIGNED;
+	if(n->floating) return RSTATUS_FLOAT_TO_INTEGER;
+
+	unsigned __int128 magnitude;
+	unsigned __int128 max = is_signed ? ~(unsigned __int128)0 >> 1 : ~(unsigned __int128)0;
+	int fits = convert_integer128(n, &magnitude);
+	if(n->negative) {
+		if(!fits || magnitude > max + 1) return RSTATUS_UNDERFLOW;
+		*out = -magnitude;
+		return RSTATUS_OK;
+	}
+	if(!fits || magnitude > max) return RSTATUS_OVERFLOW;
+	*out = magnitude;
+	return RSTATUS_OK;
+}
+
+// Two's complement reinterpretation, like the SIGNED macro does
+static enum rstatus parse_i128(const struct rparser* parser, const char* readable_number, const char* end, const char** stop, struct number* n, __int128* out) {
+	unsigned __int128 value;
+	enum rstatus status = parse_integer128(parser, readable_number, end, stop, n, 1, &value);
+	*out = value >> 127 ? -(__int128)~value - 1 : (__int128)value;
+	return status;
+}
+
+static enum rstatus parse_u128(const struct rparser* parser, const char* readable_number, const char* end, const char** stop, struct number* n, unsigned __int128* out) {
+	return parse_integer128(parser, readable_number, end, stop, n, 0, out);
+}
+
+#endif
+
+static long double to_long_double(struct number* n) {
+	long double ret = strtold(float_digits(n), NULL);
+	return n->negative ? -ret : ret;
+}
+
+#define FLOATING(name, type, tag, convert) \
+	static enum rstatus convert_##name(struct number* n, type* out) { \
+		enum rstatus status = n->floating ? RSTATUS_OK : RSTATUS_INTEGER_TO_FLOAT; \
+		*out = status ? 0 : convert(n); \
+		return status; \
+	} \
+	PARSER(name, type, tag)
+
+FLOATING(float, float, RTYPE_FLOAT, to_float)
+
+FLOATING(double, double, RTYPE_DOUBLE, to_double)
+FLOATING(longdouble, long double, RTYPE_LONGDOUBLE, to_long_double)
+
+// The public entry points only add error reporting to the parsers above.
+#define PUBLIC(name, type, label) \
+	CREADABLE_API type _r##name(char* readable_number) { \
+		struct number n; \
+		type ret; \
+		enum rstatus status = parse_##name(&default_parser, readable_number, NULL, NULL, &n, &ret); \
+		if(status) report_error(status, &n, readable_number, NULL, label); \
+		return ret; \
+	}
+
+PUBLIC(char, char, "char")
+PUBLIC(schar, signed char, "signed char")
+PUBLIC(uchar, unsigned char, "unsigned char")
+
+PUBLIC(short, short, "short")
+PUBLIC(ushort, unsigned short, "unsigned short")
+
+PUBLIC(int, int, "int")
+PUBLIC(uint, unsigned int, "unsigned int")
+
+PUBLIC(long, long, "long")
+PUBLIC(longlong, long long, "long long")
+PUBLIC(ulong, unsigned long, "unsigned long")
+PUBLIC(ulonglong, unsigned long long, "unsigned long long")
+
+PUBLIC(float, float, "float")
+
+PUBLIC(double, double, "double")
+PUBLIC(longdouble, long double, "long double")
+
+#ifdef __SIZEOF_INT128__
+PUBLIC(i128, __int128, "__int128")
+PUBLIC(u128, unsigned __int128, "unsigned __int128")
+#endif
+
+// Prefix variants: the number is read from the start of a buffer that does
+// not need to be NUL-terminated, up to the first character that cannot
+// continue it, and *end is set to that character (to readable_number
+// itself when there was no number at all).
+#define PREFIX(name, type, label) \
+	CREADABLE_API type _r##name##_n(const char* readable_number, size_t length, const char** end) { \
+		struct number n; \
+		type ret; \
+		const char* stop; \
+		enum rstatus status = parse_##name(&default_parser, readable_number, readable_number + length, &stop, &n, &ret); \
+		if(status) report_error(status, &n, readable_number, stop, label); \
+		if(end) *end = stop; \
+		return ret; \
+	}
+
+PREFIX(char, char, "char")
+PREFIX(schar, signed char, "signed char")
+PREFIX(uchar, unsigned char, "unsigned char")
+
+PREFIX(short, short, "short")
+PREFIX(ushort, unsigned short, "unsigned short")
+
+PREFIX(int, int, "int")
+PREFIX(uint, unsigned int, "unsigned int")
+
+PREFIX(long, long, "long")
+PREFIX(longlong, long long, "long long")
+PREFIX(ulong, unsigned long, "unsigned long")
+PREFIX(ulonglong, unsigned long long, "unsigned long long")
+
+PREFIX(float, float, "float")
+
+PREFIX(double, double, "double")
+PREFIX(longdouble, long double, "long double")
+
+#ifdef __SIZEOF_INT128__
+PREFIX(i128, __int128, "__int128")
+PREFIX(u128, unsigned __int128, "unsigned __int128")
+#endif
+
+// Status-returning variants: nothing is printed and the offset of the
+// offending byte comes back along with the status. The _with ones read the
+// number according to a parser configuration.
+#define EXTENDED(name, type) \
+	CREADABLE_API struct rresult r##name##_ex_with(const char* readable_number, type* out, const struct rparser* parser) { \
+		struct number n; \
+		enum rstatus status = parse_##name(parser, readable_number, NULL, NULL, &n, out); \
+		return (struct rresult){status, status && n.error_at ? (size_t)(n.error_at - readable_number) : 0}; \
+	} \
+	CREADABLE_API struct rresult r##name##_ex(const char* readable_number, type* out) { \
+		return r##name##_ex_with(readable_number, out, &default_parser); \
+	}
+
+EXTENDED(char, char)
+EXTENDED(schar, signed char)
+EXTENDED(uchar, unsigned char)
+
+EXTENDED(short, short)
+EXTENDED(ushort, unsigned short)
+
+EXTENDED(int, int)
+EXTENDED(uint, unsigned int)
+
+EXTENDED(long, long)
+EXTENDED(longlong, long long)
+EXTENDED(ulong, unsigned long)
+EXTENDED(ulonglong, unsigned long long)
+
+EXTENDED(float, float)
+
+EXTENDED(double, double)
+EXTENDED(longdouble, long double)
+
+#ifdef __SIZEOF_INT128__
+EXTENDED(i128, __int128)
+EXTENDED(u128, unsigned __int128)
+#endif
+
+// ===========================
+// Validation
+// ===========================
+
+// rvalidate() sorts the bytes of a number into one bit mask per kind of
+// byte, 64 bytes at a time and a vector at a time where the CPU has them
+// (see CPU dispatch), and checks the extract_number rules on the masks with
+// a handful of bit operations, carrying what later blocks need to know.
+// Whatever the masks cannot vouch for (radix prefixes, unusual but valid
+// placements, and of course errors) goes through scan_number, which checks
+// the rules byte by byte and finds the offending one. Neither keeps or
+// converts a digit.
+
+// What the blocks so far tell about the number.
+struct shape {
+	unsigned separators; // kinds used: 1 '_', 2 ',', 4 ' ', 8 '\t'
+	unsigned pending;    // whitespace kinds after the last other byte
+	char solid;          // any byte other than whitespace
+	char digit;
+	char point;
+	char exponent;
+	char exponent_digit;
+	char exponent_last;  // the previous block ended with 'e'
+	char before_point;   // a digit, separator or '-' a '.' may follow
+};
+
+// Whether the masks of the first `length` bytes of the next block keep the
+// number well formed. Only ever says yes for numbers extract_number
+// accepts; a no merely means scan_number has to look.
+static int block_well_formed(const struct byte_masks* m, size_t length, struct shape* s) {
+	uint64_t all = length == 64 ? ~0ULL : (1ULL << length) - 1;
+	uint64_t whitespace = m->space | m->tab;
+	uint64_t known = m->digit | m->underscore | m->comma | whitespace | m->point | m->exponent | m->minus | m->plus;
+	if(known != all) return 0;
+
+	// whitespace before the last other byte is made of separators, after
+	// it it is ignored; only one kind of separator can be used
+	uint64_t solid = all & ~whitespace;
+	uint64_t inner = solid;
+	inner |= inner >> 1;
+	inner |= inner >> 2;
+	inner |= inner >> 4;
+	inner |= inner >> 8;
+	inner |= inner >> 16;
+	inner |= inner >> 32;
+	if(solid) {
+		s->separators |= s->pending | (m->space & inner ? 4 : 0) | (m->tab & inner ? 8 : 0);
+		s->pending = 0;
+	}
+	s->pending |= (m->space & ~inner ? 4 : 0) | (m->tab & ~inner ? 8 : 0);
+	s->separators |= (m->underscore ? 1 : 0) | (m->comma ? 2 : 0);
+	if(s->separators & (s->separators - 1)) return 0;
+
+	// one 'e', with digits on both sides and no '.' after it
+	uint64_t exponent_sign = m->exponent << 1 | (uint64_t)s->exponent_last;
+	if(m->exponent) {
+		if(s->exponent || (m->exponent & (m->exponent - 1))) return 0;
+		uint64_t before = m->exponent - 1;
+		uint64_t after = all & ~before & ~m->exponent;
+		if(!s->digit && !(m->digit & before)) return 0;
+		if(m->point & after) return 0;
+		s->exponent = 1;
+		s->exponent_digit = (m->digit & after) != 0;
+	}
+	else if(s->exponent) {
+		if(m->point) return 0;
+		s->exponent_digit |= m->digit != 0;
+	}
+	s->exponent_last = (char)(m->exponent >> 63);
+
+	// '-' as the first byte that is not whitespace, '-' or '+' right after 'e'
+	uint64_t first = s->solid ? 0 : solid & (0 - solid);
+	if((m->minus & ~(first | exponent_sign)) || (m->plus & ~exponent_sign)) return 0;
+
+	// one '.', after a digit, a separator or the sign
+	uint64_t allows_point = m->digit | m->underscore | m->comma | m->minus;
+	if(m->point) {
+		if(s->point || (m->point & (m->point - 1))) return 0;
+		if(!s->before_point && !(allows_point & (m->point - 1))) return 0;
+		s->point = 1;
+	}
+	s->before_point |= allows_point != 0;
+	s->solid |= solid != 0;
+	s->digit |= m->digit != 0;
+	return 1;
+}
+
+// The digits after 0x, 0o or 0b, as extract_radix checks them.
+static enum rstatus scan_radix(const struct rparser* parser, const char* prefix, const char* end, char separator, unsigned bits, const char** error_at) {
+	unsigned base = 1u << bits;
+	char digits = 0;
+	const char* whitespace = NULL;
+
+	#define FAIL(status, at) do { \
+		*error_at = (at); \
+		return (status); \
+	} while(0)
+	#define SEPARATOR(at) do { \
+		if(separator && separator != *(at)) FAIL(RSTATUS_SEPARATOR_MISMATCH, at); \
+		separator = *(at); \
+	} while(0)
+
+	for(const char* p = prefix + 1; p != end; ++p) {
+		unsigned char class = parser->classes[(unsigned char)*p];
+		if(class == CLASS_SPACE || class == CLASS_BLANK) {
+			if(!whitespace) whitespace = p;
+			continue;
+		}
+		if(class == CLASS_END) FAIL(RSTATUS_INVALID_SYMBOL, p);
+		if(whitespace) {
+			for(const char* w = whitespace; w < p; ++w) {
+				if(parser->classes[(unsigned char)*w] == CLASS_BLANK) FAIL(RSTATUS_INVALID_SYMBOL, w);
+				SEPARATOR(w);
+			}
+			whitespace = NULL;
+		}
+
+		if(digit_values[(unsigned char)*p] < base) {
+			digits = 1;
+			continue;
+		}
+		switch(class) {
+		case CLASS_SEPARATOR:
+			SEPARATOR(p);
+		break;
+		case CLASS_MINUS:
+		case CLASS_PLUS:
+		case CLASS_EXPONENT_PLUS:
+		case CLASS_POINT:
+			FAIL(RSTATUS_MISPLACED_SYMBOL, p);
+		break;
+		default:
+			FAIL(RSTATUS_INVALID_SYMBOL, p);
+		break;
+		}
+	}
+	if(!digits) FAIL(RSTATUS_MISPLACED_SYMBOL, prefix);
+	return RSTATUS_OK;
+}
+
+// extract_number's rules over the length bytes up to end, with the same
+// status at the same byte (*error_at, NULL if there is none to point at),
+// but no digit is kept and nothing is converted.
+static enum rstatus scan_number(const struct rparser* parser, const char* rn, const char* end, const char** error_at) {
+	char separator = '\0';
+	char leading_spaces = 1;
+	char point = 0;
+	char digits = 0;
+	const char* whitespace = NULL;
+	const char* exponent_symbol = NULL;
+	char exponent_sign = 0;
+	char exponent_digits = 0;
+	*error_at = NULL;
+
+	for(const char* p = rn; p != end; ++p) {
+		unsigned char class = parser->classes[(unsigned char)*p];
+		if(class == CLASS_SPACE || class == CLASS_BLANK) {
+			if(!whitespace) whitespace = p;
+			continue;
+		}
+		if(class == CLASS_END) FAIL(RSTATUS_INVALID_SYMBOL, p);
+		if(whitespace) {
+			for(const char* w = whitespace; w < p; ++w) {
+				if(parser->classes[(unsigned char)*w] == CLASS_BLANK) {
+					if(leading_spaces) continue;
+					FAIL(RSTATUS_INVALID_SYMBOL, w);
+				}
+				SEPARATOR(w);
+			}
+			whitespace = NULL;
+		}
+
+		switch(class) {
+		case CLASS_MINUS:
+		case CLASS_PLUS:
+		case CLASS_EXPONENT_PLUS:
+			if(exponent_symbol && !exponent_sign && !exponent_digits) {
+				exponent_sign = 1;
+				break;
+			}
+			if(class == CLASS_EXPONENT_PLUS || !leading_spaces) FAIL(RSTATUS_MISPLACED_SYMBOL, p);
+			leading_spaces = 0;
+		break;
+		case CLASS_DIGIT:
+			leading_spaces = 0;
+			if(*p == '0' && !digits && !point && p + 1 != end) {
+				unsigned bits = radix_bits(p[1]);
+				if(bits) return scan_radix(parser, p + 1, end, separator, bits, error_at);
+			}
+			if(exponent_symbol) exponent_digits = 1;
+			else digits = 1;
+			p += digit_run(p, end) - 1;
+		break;
+		case CLASS_SEPARATOR:
+			leading_spaces = 0;
+			SEPARATOR(p);
+		break;
+		case CLASS_POINT:
+			if(leading_spaces || point || exponent_symbol) FAIL(RSTATUS_MISPLACED_SYMBOL, p);
+			point = 1;
+		break;
+		case CLASS_EXPONENT:
+			if(!digits || exponent_symbol) FAIL(RSTATUS_MISPLACED_SYMBOL, p);
+			exponent_symbol = p;
+		break;
+		default:
+			FAIL(RSTATUS_INVALID_SYMBOL, p);
+		break;
+		}
+	}
+	#undef SEPARATOR
+	#undef FAIL
+
+	if(!digits) return RSTATUS_EMPTY;
+	if(exponent_symbol && !exponent_digits) {
+		*error_at = exponent_symbol;
+		return RSTATUS_MISSING_EXPONENT;
+	}
+	return RSTATUS_OK;
+}
+
+CREADABLE_API struct rresult rvalidate(const char* number, size_t length) {
+	struct shape s = {0, 0, 0, 0, 0, 0, 0, 0, 0};
+	struct byte_masks m;
+	size_t i = 0;
+	int well_formed = 1;
+	for(; well_formed && length - i > 64; i += 64) {
+		kernels->classify(number + i, 64, &m);
+		well_formed = block_well_formed(&m, 64, &s);
+	}
+	if(well_formed) {
+		// the last block padded with NULs, which are not of any kind
+		char bytes[64] = {0};
+		memcpy(bytes, number + i, length - i);
+		kernels->classify(bytes, length - i, &m);
+		if(block_well_formed(&m, length - i, &s) && s.digit && (!s.exponent || s.exponent_digit)) return (struct rresult){RSTATUS_OK, 0};
+	}
+
+	const char* error_at;
+	enum rstatus status = scan_number(&default_parser, number, number + length, &error_at);
+	return (struct rresult){status, error_at ? (size_t)(error_at - number) : 0};
+}
+
+CREADABLE_API size_t rvalidate_batch(const char* const* numbers, size_t count, unsigned char* invalid) {
+	if(invalid) memset(invalid, 0, (count + 7)/8);
+	size_t failed = 0;
+	for(size_t i = 0; i < count; ++i) {
+		if(!rvalidate(numbers[i], strlen(numbers[i])).status) continue;
+		++failed;
+		if(invalid) invalid[i/8] |= (unsigned char)(1u << i%8);
+	}
+	return failed;
+}
+
+// ===========================
+// Formatting
+// ===========================
+
+// The inverse of the parsers: digits are written straight into the
+// caller's buffer from the right, two at a time from a table of all pairs
+// (three at a time, as one digit and a pair, between separators). The length
+// is known up front from the digit count, so nothing is written twice.
+static const char digit_pairs[] =
+	"00010203040506070809" "10111213141516171819" "20212223242526272829" "30313233343536373839"
+	"40414243444546474849" "50515253545556575859" "60616263646566676869" "70717273747576777879"
+	"80818283848586878889" "90919293949596979899";
+
+static const unsigned long long powers_of_ten[20] = {
+	1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL, 100000000ULL,
+	1000000000ULL, 10000000000ULL, 100000000000ULL, 1000000000000ULL, 10000000000000ULL,
+	100000000000000ULL, 1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+	1000000000000000000ULL, 10000000000000000000ULL
+};
+
+// log10 from the bit length (1233/4096 ~ log10(2)), then one comparison
+// to correct it
+static int count_digits(unsigned long long value) {
+#if defined(__GNUC__)
+	int bits = 64 - __builtin_clzll(value | 1);
+#else
+	int bits = 1;
+	while(bits < 64 && value >> bits) ++bits;
+#endif
+	int guess = (bits*1233) >> 12;
+	return guess + (value >= powers_of_ten[guess]) + (value == 0);
+}
+
+static size_t format_integer(unsigned long long magnitude, char negative, char separator, char* buffer, size_t size) {
+	int digits = count_digits(magnitude);
+	size_t length = (size_t)digits + (separator ? (size_t)(digits - 1)/3 : 0) + (negative ? 1 : 0);
+	if(length >= size) {
+		if(size) buffer[0] = '\0';
+		return length;
+	}
+
+	char* p = buffer + length;
+	*p = '\0';
+	if(separator) {
+		while(magnitude >= 1000) {
+			unsigned group = (unsigned)(magnitude % 1000);
+			magnitude /= 1000;
+			p -= 4;
+			p[0] = separator;
+			p[1] = (char)('0' + group/100);
+			memcpy(p + 2, digit_pairs + 2*(group % 100), 2);
+		}
+	}
+	else {
+		while(magnitude >= 100) {
+			p -= 2;
+			memcpy(p, digit_pairs + 2*(magnitude % 100), 2);
+			magnitude /= 100;
+		}
+	}
+	if(magnitude >= 100) {
+		p -= 3;
+		p[0] = (char)('0' + magnitude/100);
+		memcpy(p + 1, digit_pairs + 2*(magnitude % 100), 2);
+	}
+	else if(magnitude >= 10) {
+		p -= 2;
+		memcpy(p, digit_pairs + 2*magnitude, 2);
+	}
+	else {
+		*--p = (char)('0' + magnitude);
+	}
+	if(negative) *--p = '-';
+	return length;
+}
+
+// Only the separators every parser reads back. Anything else is reported
+// and formats to an empty string of length 0, which no value formats to.
+static int invalid_separator(char separator, char* buffer, size_t size) {
+	if(!separator || separator == '_' || separator == ',' || separator == ' ') return 0;
+	char buf[2];
+	emit_error(RSTATUS_INVALID_ARGUMENT, "[CREADABLE ERROR] '%s' cannot be used as separator.", separator_name(separator, buf));
+	if(size) buffer[0] = '\0';
+	return 1;
+}
+
+#define FORMAT_SIGNED(name, type) \
+	CREADABLE_API size_t rformat_##name(type value, char separator, char* buffer, size_t size) { \
+		if(invalid_separator(separator, buffer, size)) return 0; \
+		long long wide = value; \
+		return format_integer(wide < 0 ? 0ULL - (unsigned long long)wide : (unsigned long long)wide, wide < 0, separator, buffer, size); \
+	}
+
+#define FORMAT_UNSIGNED(name, type) \
+	CREADABLE_API size_t rformat_##name(type value, char separator, char* buffer, size_t size) { \
+		if(invalid_separator(separator, buffer, size)) return 0; \
+		return format_integer(value, 0, separator, buffer, size); \
+	}
+
+FORMAT_SIGNED(char, char)
+FORMAT_SIGNED(schar, signed char)
+FORMAT_UNSIGNED(uchar, unsigned char)
+
+FORMAT_SIGNED(short, short)
+FORMAT_UNSIGNED(ushort, unsigned short)
+
+FORMAT_SIGNED(int, int)
+FORMAT_UNSIGNED(uint, unsigned int)
+
+FORMAT_SIGNED(long, long)
+FORMAT_SIGNED(longlong, long long)
+FORMAT_UNSIGNED(ulong, unsigned long)
+FORMAT_UNSIGNED(ulonglong, unsigned long long)
+
+// Floating point values are written with the fewest significant digits
+// that read back to the same value: digits * 10^exponent.
+struct shortest {
+	uint64_t digits;
+	int exponent;
+};
+
+#ifdef CREADABLE_BINARY_FLOATS
+
+// Schubfach (R. Giulietti, "The Schubfach way to render doubles"): the
+// value and both ends of the interval that rounds to it are multiplied by
+// one power of ten g, rounded to odd so comparisons between them stay
+// exact, and the interval is then narrow enough to hold at most one
+// multiple of ten or two consecutive integers to choose from. g is
+// floor(10^e * 2^-r) + 1 on 128 bits, one more than the truncated entry of
+// the Eisel-Lemire table except for 5^-27 to 5^-1, which it rounds up.
+static void power_of_ten_significand(int e, uint64_t* high, uint64_t* low) {
+	size_t index = 2*(size_t)(e - SMALLEST_POWER_OF_FIVE);
+	*high = power_of_five_128[index];
+	*low = power_of_five_128[index + 1];
+	if(e < -27 || e >= 0) {
+		if(!++*low) ++*high;
+	}
+}
+
+// floor(log10(2^e)), floor(log10(3/4 * 2^e)) and floor(log2(10^e))
+#define FLOOR_LOG10_POW2(e) (((e)*1262611) >> 22)
+#define FLOOR_LOG10_THREE_QUARTERS_POW2(e) (((e)*1262611 - 524031) >> 22)
+#define FLOOR_LOG2_POW10(e) (((e)*1741647) >> 19)
+
+// The high word of g*cp, made odd if anything below it is set.
+static uint64_t round_to_odd(uint64_t g_high, uint64_t g_low, uint64_t cp) {
+	uint64_t x_high, y_high;
+	full_multiplication(g_low, cp, &x_high);
+	uint64_t y_low = full_multiplication(g_high, cp, &y_high);
+	uint64_t z = y_low + x_high;
+	return (y_high + (z < y_low)) | (z > 1);
+}
+
+// float has enough with the high word of g.
+static uint32_t round_to_odd32(uint64_t g, uint32_t cp) {
+	uint64_t high;
+	uint64_t low = full_multiplication(g, cp, &high);
+	return (uint32_t)high | ((uint32_t)(low >> 32) > 1);
+}
+
+// vb is the value scaled by 10^-k, vbl and vbr the ends of its interval,
+// all of them four times too large.
+static struct shortest pick_shortest(uint64_t vbl, uint64_t vb, uint64_t vbr, int even, int k) {
+	uint64_t lower = vbl + !even, upper = vbr - !even;
+	uint64_t s = vb/4;
+	if(s >= 10) {
+		// one digit less, when only one of the two multiples of ten is inside
+		uint64_t sp = s/10;
+		int up_inside = lower <= 40*sp, wp_inside = 40*sp + 40 <= upper;
+		if(up_inside != wp_inside) return (struct shortest){sp + (uint64_t)wp_inside, k + 1};
+	}
+	int u_inside = lower <= 4*s, w_inside = 4*s + 4 <= upper;
+	if(u_inside != w_inside) return (struct shortest){s + (uint64_t)w_inside, k};
+	// both are inside: the closer one, the even one on a tie
+	uint64_t mid = 4*s + 2;
+	return (struct shortest){s + (uint64_t)(vb > mid || (vb == mid && (s & 1))), k};
+}
+
+// The sign is left to the caller.
+static struct shortest shortest_double(double value) {
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	uint64_t fraction = bits & ((1ULL << 52) - 1);
+	int biased = (int)(bits >> 52 & 0x7FF);
+	uint64_t c;
+	int q;
+	if(biased) {
+		c = fraction | 1ULL << 52;
+		q = biased - 1075;
+		// integers below 2^53 are their own digits
+		if(q <= 0 && q > -53 && !(c & ((1ULL << -q) - 1))) return (struct shortest){c >> -q, 0};
+	}
+	else {
+		if(!fraction) return (struct shortest){0, 0};
+		c = fraction;
+		q = -1074;
+	}
+
+	// at a power of two the next value down is twice as close as the next one up
+	int closer = !fraction && biased > 1;
+	int k = closer ? FLOOR_LOG10_THREE_QUARTERS_POW2(q) : FLOOR_LOG10_POW2(q);
+	int h = q + FLOOR_LOG2_POW10(-k) + 1;
+	uint64_t g_high, g_low;
+	power_of_ten_significand(-k, &g_high, &g_low);
+	uint64_t vbl = round_to_odd(g_high, g_low, (4*c - 2 + (uint64_t)closer) << h);
+	uint64_t vb = round_to_odd(g_high, g_low, 4*c << h);
+	uint64_t vbr = round_to_odd(g_high, g_low, (4*c + 2) << h);
+	return pick_shortest(vbl, vb, vbr, !(c & 1), k);
+}
+
+static struct shortest shortest_float(float value) {
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	uint32_t fraction = bits & ((1u << 23) - 1);
+	int biased = (int)(bits >> 23 & 0xFF);
+	uint32_t c;
+	int q;
+	if(biased) {
+		c = fraction | 1u << 23;
+		q = biased - 150;
+		if(q <= 0 && q > -24 && !(c & ((1u << -q) - 1))) return (struct shortest){c >> -q, 0};
+	}
+	else {
+		if(!fraction) return (struct shortest){0, 0};
+		c = fraction;
+		q = -149;
+	}
+
+	int closer = !fraction && biased > 1;
+	int k = closer ? FLOOR_LOG10_THREE_QUARTERS_POW2(q) : FLOOR_LOG10_POW2(q);
+	int h = q + FLOOR_LOG2_POW10(-k) + 1;
+	// the high word is truncated even where the table rounds up
+	uint64_t g = power_of_five_128[2*(size_t)(-k - SMALLEST_POWER_OF_FIVE)] + 1;
+	uint32_t vbl = round_to_odd32(g, (4*c - 2 + (uint32_t)closer) << h);
+	uint32_t vb = round_to_odd32(g, 4*c << h);
+	uint32_t vbr = round_to_odd32(g, (4*c + 2) << h);
+	return pick_shortest(vbl, vb, vbr, !(c & 1), k);
+}
+
+#else
+
+// Without IEEE floats to take apart, the shortest %.*e that reads back.
+static struct shortest shortest_text(double value, int max_digits, int single) {
+	char text[48];
+	int precision = 0;
+	for(;; ++precision) {
+		snprintf(text, sizeof(text), "%.*e", precision, value);
+		if(precision + 1 >= max_digits) break;
+		if(single ? strtof(text, NULL) == (float)value : strtod(text, NULL) == value) break;
+	}
+	struct shortest d = {0, 0};
+	char* p = text;
+	for(; *p != 'e'; ++p) {
+		if(*p >= '0' && *p <= '9') d.digits = d.digits*10 + (uint64_t)(*p - '0');
+	}
+	d.exponent = atoi(p + 1) - precision;
+	return d;
+}
+
+#define shortest_double(value) shortest_text(value, DBL_DECIMAL_DIG, 0)
+#define shortest_float(value) shortest_text(value, FLT_DECIMAL_DIG, 1)
+
+#endif
+
+// Plain notation from 1e-6 to below 1e21, as JavaScript writes numbers,
+// and d.ddde-x outside of that. The length is worked out first here too.
+static size_t format_shortest(struct shortest d, char negative, char separator, char* buffer, size_t size) {
+	while(d.digits && d.digits % 10 == 0) d.digits /= 10, ++d.exponent;
+	char digits[20];
+	int count = count_digits(d.digits);
+	unsigned long long rest = d.digits;
+	char* q = digits + count;
+	while(rest >= 100) {
+		q -= 2;
+		memcpy(q, digit_pairs + 2*(rest % 100), 2);
+		rest /= 100;
+	}
+	if(rest >= 10) memcpy(q - 2, digit_pairs + 2*rest, 2);
+	else q[-1] = (char)('0' + rest);
+
+	int point = count + d.exponent; // digits before the decimal point
+	int exponent = point - 1;
+	int scientific = point > 21 || point < -5;
+	size_t length = negative ? 1 : 0;
+	if(scientific) {
+		unsigned magnitude = (unsigned)(exponent < 0 ? -exponent : exponent);
+		length += (size_t)(count > 1 ? count + 1 : 3) + 1 + (exponent < 0) + (size_t)count_digits(magnitude);
+	}
+	else if(point > 0) {
+		length += (size_t)point + (separator ? (size_t)(point - 1)/3 : 0) + 1 + (size_t)(count > point ? count - point : 1);
+	}
+	else {
+		length += 2 + (size_t)-point + (size_t)count;
+	}
+	if(length >= size) {
+		if(size) buffer[0] = '\0';
+		return length;
+	}
+
+	char* p = buffer;
+	if(negative) *p++ = '-';
+	if(scientific) {
+		*p++ = digits[0];
+		*p++ = '.';
+		if(count > 1) {
+			memcpy(p, digits + 1, (size_t)count - 1);
+			p += count - 1;
+		}
+		else *p++ = '0';
+		*p++ = 'e';
+		if(exponent < 0) *p++ = '-', exponent = -exponent;
+		format_integer((unsigned long long)exponent, 0, '\0', p, 4);
+		return length;
+	}
+	if(point > 0) {
+		// trailing zeros of an integer part longer than the digits
+		for(int i = 0; i < point; ++i) {
+			if(separator && i && (point - i) % 3 == 0) *p++ = separator;
+			*p++ = i < count ? digits[i] : '0';
+		}
+		*p++ = '.';
+		if(count > point) {
+			memcpy(p, digits + point, (size_t)(count - point));
+			p += count - point;
+		}
+		else *p++ = '0';
+	}
+	else {
+		*p++ = '0';
+		*p++ = '.';
+		memset(p, '0', (size_t)-point);
+		p += -point;
+		memcpy(p, digits, (size_t)count);
+		p += count;
+	}
+	*p = '\0';
+	return length;
+}
+
+// Without math.h, whose rint() clashes with ours in header-only mode.
+static int sign_bit(double value) {
+#ifdef CREADABLE_BINARY_FLOATS
+	uint64_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return (int)(bits >> 63);
+#else
+	return value < 0 || (value == 0 && 1/value < 0);
+#endif
+}
+
+static size_t format_special(const char* text, char* buffer, size_t size) {
+	size_t length = strlen(text);
+	if(length >= size) {
+		if(size) buffer[0] = '\0';
+		return length;
+	}
+	memcpy(buffer, text, length + 1);
+	return length;
+}
+
+CREADABLE_API size_t rformat_float(float value, char separator, char* buffer, size_t size) {
+	if(invalid_separator(separator, buffer, size)) return 0;
+	if(value != value) return format_special("nan", buffer, size);
+	if(value - value != 0) return format_special(value < 0 ? "-inf" : "inf", buffer, size);
+	char negative = (char)sign_bit(value);
+	return format_shortest(shortest_float(negative ? -value : value), negative, separator, buffer, size);
+}
+
+CREADABLE_API size_t rformat_double(double value, char separator, char* buffer, size_t size) {
+	if(invalid_separator(separator, buffer, size)) return 0;
+	if(value != value) return format_special("nan", buffer, size);
+	if(value - value != 0) return format_special(value < 0 ? "-inf" : "inf", buffer, size);
+	char negative = (char)sign_bit(value);
+	return format_shortest(shortest_double(negative ? -value : value), negative, separator, buffer, size);
+}
+
+// ===========================
+// Fixed point
+// ===========================
+
+// The number is scaled by moving its decimal point within the gathered
+// digits: the ones left of it go through the integer kernels, the ones
+// right of it only decide the rounding.
+enum remainder {
+	REMAINDER_NONE,
+	REMAINDER_BELOW_HALF,
+	REMAINDER_HALF,
+	REMAINDER_ABOVE_HALF
+};
+
+// Leaves the integer digits of the number times 10^scale in n->digits,
+// zero padded, and what the dropped ones amount to in *remainder. Returns
+// 0 if there are more than max_digits of them.
+static int scale_digits(struct number* n, unsigned scale, size_t max_digits, enum remainder* remainder) {
+	*remainder = REMAINDER_NONE;
+	if(!n->ndigits) return 1;
+	long long point = (long long)n->ndigits + n->exponent + scale;
+	if(point > (long long)max_digits) return 0;
+
+	size_t kept = point > 0 ? (size_t)point : 0;
+	if(kept > n->ndigits) {
+		memset(n->digits + n->ndigits, '0', kept - n->ndigits);
+	}
+	else if(kept < n->ndigits) {
+		// digits[0] is never a zero, so a point before it leaves less than half
+		unsigned first = point < 0 ? 0 : (unsigned)(n->digits[kept] - '0');
+		int rest = point < 0;
+		for(size_t i = kept + 1; i < n->ndigits && !rest; ++i) rest = n->digits[i] != '0';
+		if(first > 5 || (first == 5 && rest)) *remainder = REMAINDER_ABOVE_HALF;
+		else if(first == 5) *remainder = REMAINDER_HALF;
+		else if(first || rest) *remainder = REMAINDER_BELOW_HALF;
+	}
+	n->ndigits = kept;
+	return 1;
+}
+
+// Whether the magnitude, odd or not, goes up by one.
+static int round_away(enum rrounding rounding, enum remainder remainder, int negative, int odd) {
+	switch(rounding) {
+	case RROUND_HALF_EVEN:
+		return remainder == REMAINDER_ABOVE_HALF || (remainder == REMAINDER_HALF && odd);
+	case RROUND_HALF_AWAY:
+		return remainder >= REMAINDER_HALF;
+	case RROUND_FLOOR:
+		return remainder && negative;
+	case RROUND_CEILING:
+		return remainder && !negative;
+	default:
+		return 0;
+	}
+}
+
+// convert_integer128's interface for the 64-bit kernel, whose 0x, 0o and
+// 0b values extract_number already converted.
+static int convert_integer64(struct number* n, uint64_t* out) {
+	if(!n->bits) {
+		n->overflow = 0;
+		convert_integer(n);
+	}
+	*out = n->value;
+	return !n->overflow;
+}
+
+// Amounts are nearly always an optional '-', up to 19 digits grouped with
+// '_' or ',' and a decimal point: those are read in one tight loop straight
+// into a 64-bit value. Returns 0 for anything else (whitespace, exponents,
+// prefixes, longer numbers, errors, a value that does not fit 64 bits once
+// scaled), which then goes through extract_number.
+static int scan_fixed(const char* readable_number, unsigned scale, uint64_t* magnitude, enum remainder* remainder, char* negative) {
+	const char* p = readable_number;
+	*negative = *p == '-';
+	p += *negative;
+
+	uint64_t value = 0;
+	unsigned digits = 0, fraction = 0;
+	char separator = '\0', point = 0;
+	for(;; ++p) {
+		unsigned digit = (unsigned)(unsigned char)*p - '0';
+		if(digit < 10) {
+			if(++digits > 19) return 0;
+			value = value*10 + digit;
+			fraction += (unsigned)point;
+		}
+		else if(*p == '_' || *p == ',') {
+			if(separator && separator != *p) return 0;
+			separator = *p;
+		}
+		else if(*p == '.' && !point && p != readable_number) {
+			point = 1;
+		}
+		else if(!*p) {
+			break;
+		}
+		else {
+			return 0;
+		}
+	}
+	if(!digits) return 0;
+
+	*remainder = REMAINDER_NONE;
+	if(scale >= fraction) {
+		if(scale - fraction > 19 || (value && value > UINT64_MAX/powers_of_ten[scale - fraction])) return 0;
+		*magnitude = value*powers_of_ten[scale - fraction];
+		return 1;
+	}
+	uint64_t divisor = powers_of_ten[fraction - scale], rest = value % divisor;
+	*magnitude = value/divisor;
+	if(rest > divisor - rest) *remainder = REMAINDER_ABOVE_HALF;
+	else if(rest && rest == divisor - rest) *remainder = REMAINDER_HALF;
+	else if(rest) *remainder = REMAINDER_BELOW_HALF;
+	return 1;
+}
+
+// 0x, 0o and 0b numbers are integers, only ever scaled up.
+#define FIXED(name, type, magnitude_type, max_digits, convert) \
+	CREADABLE_API struct rresult rdecimal_##name(const char* readable_number, unsigned scale, enum rrounding rounding, type* out) { \
+		enum remainder remainder = REMAINDER_NONE; \
+		magnitude_type magnitude = 0, max = (magnitude_type)-1; \
+		uint64_t small; \
+		char negative; \
+		int fits = 1; \
+		*out = 0; \
+		if((unsigned)rounding > RROUND_CEILING) return (struct rresult){RSTATUS_INVALID_ARGUMENT, 0}; \
+		if(scan_fixed(readable_number, scale, &small, &remainder, &negative)) { \
+			magnitude = small; \
+		} \
+		else { \
+			struct number n; \
+			enum rstatus status = extract_number(&default_parser, readable_number, NULL, NULL, &n); \
+			if(status) return (struct rresult){status, n.error_at ? (size_t)(n.error_at - readable_number) : 0}; \
+			negative = n.negative; \
+			fits = (n.bits || scale_digits(&n, scale, max_digits, &remainder)) && convert(&n, &magnitude); \
+			for(unsigned i = 0; fits && n.bits && magnitude && i < scale; ++i) { \
+				fits = magnitude <= max/10; \
+				magnitude *= 10; \
+			} \
+		} \
+		if(fits && remainder) { \
+			if(rounding == RROUND_EXACT) return (struct rresult){RSTATUS_INEXACT, 0}; \
+			if(round_away(rounding, remainder, negative, (int)(magnitude & 1))) { \
+				fits = magnitude != max; \
+				++magnitude; \
+			} \
+		} \
+		if(!fits || magnitude > (max >> 1) + (magnitude_type)negative) { \
+			return (struct rresult){negative ? RSTATUS_UNDERFLOW : RSTATUS_OVERFLOW, 0}; \
+		} \
+		*out = negative ? (magnitude ? -(type)(magnitude - 1) - 1 : 0) : (type)magnitude; \
+		return (struct rresult){RSTATUS_OK, 0}; \
+	}
+
+FIXED(i64, int64_t, uint64_t, 20, convert_integer64)
+
+#ifdef __SIZEOF_INT128__
+FIXED(i128, __int128, unsigned __int128, 39, convert_integer128)
+#endif
+
+// ===========================
+// Big integers
+// ===========================
+
+// extract_number checks the number as it would for any other type, then a
+// second pass reads its digits again into chunks of 19 (a limb's worth in
+// the power of two bases), each one a 64-bit word. Up to
+// BIG_SCHOOLBOOK_CHUNKS of them are multiplied in one after the other;
+// longer numbers are split in two, high*10^(19h) + low, h a power of two,
+// with the powers squared from 10^19 up front and the products done by
+// Karatsuba, so the time grows as n^1.6 log n rather than n^2.
+// All the memory is the caller's: the result goes at the start of the
+// workspace, the chunks at its end and the scratch space in between.
+#define BIG_SCHOOLBOOK_CHUNKS 64
+#define KARATSUBA_LIMBS 32
+#define BIG_CHUNK 10000000000000000000ULL // 10^19
+
+// Scratch limbs, taken and given back last in first out.
+struct limb_stack {
+	uint64_t* next;
+	uint64_t* end;
+};
+
+static uint64_t* limb_alloc(struct limb_stack* s, size_t count) {
+	if((size_t)(s->end - s->next) < count) return NULL;
+	uint64_t* limbs = s->next;
+	s->next += count;
+	return limbs;
+}
+
+// a += b, with b no longer than a; returns the carry out of a.
+static uint64_t add_limbs(uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+	uint64_t carry = 0;
+	size_t i = 0;
+	for(; i < bn; ++i) {
+		uint64_t sum = a[i] + carry;
+		carry = sum < carry;
+		a[i] = sum + b[i];
+		carry += a[i] < sum;
+	}
+	for(; carry && i < an; ++i) carry = !++a[i];
+	return carry;
+}
+
+// a -= b, with b no larger than a.
+static void sub_limbs(uint64_t* a, size_t an, const uint64_t* b, size_t bn) {
+	uint64_t borrow = 0;
+	size_t i = 0;
+	for(; i < bn; ++i) {
+		uint64_t difference = a[i] - b[i];
+		uint64_t below = a[i] < b[i];
+		a[i] = difference - borrow;
+		borrow = below | (difference < borrow);
+	}
+	for(; borrow && i < an; ++i) borrow = !a[i]--;
+}
+
+// limbs = limbs*factor + addend, returns the new length.
+static size_t multiply_add(uint64_t* limbs, size_t length, uint64_t factor, uint64_t addend) {
+	uint64_t carry = addend;
+	for(size_t i = 0; i < length; ++i) {
+		uint64_t high;
+		uint64_t low = full_multiplication(limbs[i], factor, &high);
+		low += carry;
+		carry = high + (low < carry);
+		limbs[i] = low;
+	}
+	if(carry) limbs[length++] = carry;
+	return length;
+}
+
+static void multiply_schoolbook(const uint64_t* a, size_t an, const uint64_t* b, size_t bn, uint64_t* out) {
+	memset(out, 0, (an + bn)*sizeof(uint64_t));
+	for(size_t i = 0; i < an; ++i) {
+		uint64_t carry = 0;
+		for(size_t j = 0; j < bn; ++j) {
+			uint64_t high;
+			uint64_t low = full_multiplication(a[i], b[j], &high);
+			low += carry;
+			high += low < carry;
+			out[i + j] += low;
+			carry = high + (out[i + j] < low);
+		}
+		out[i + bn] = carry;
+	}
+}
+
+// out = a*b, an + bn limbs of it. Returns 0 if the scratch space runs out.
+static int multiply_limbs(const uint64_t* a, size_t an, const uint64_t* b, size_t bn, uint64_t* out, struct limb_stack* s) {
+	if(an < bn) {
+		const uint64_t* swap = a;
+		a = b, b = swap;
+		size_t swap_length = an;
+		an = bn, bn = swap_length;
+	}
+	if(bn < KARATSUBA_LIMBS) {
+		multiply_schoolbook(a, an, b, bn, out);
+		return 1;
+	}
 
-#include "creadable.h"
+	uint64_t* mark = s->next;
+	if(2*bn <= an) {
+		// slices of a as long as b
+		uint64_t* product = limb_alloc(s, 2*bn);
+		if(!product) return 0;
+		memset(out, 0, (an + bn)*sizeof(uint64_t));
+		for(size_t i = 0; i < an; i += bn) {
+			size_t length = an - i < bn ? an - i : bn;
+			if(!multiply_limbs(a + i, length, b, bn, product, s)) return 0;
+			add_limbs(out + i, an + bn - i, product, length + bn);
+		}
+		s->next = mark;
+		return 1;
+	}
 
-static void extract_number(char* rn, char** number, size_t* len, char* negative, char* floating) {
-	*number = NULL;
-	*negative = 0;
-	*floating = 0;
-	if(len) *len = 0;
-	size_t rnlen = strlen(rn);
+	// a1*b1 B^2h + ((a0 + a1)(b0 + b1) - a0*b0 - a1*b1) B^h + a0*b0,
+	// with b longer than h
+	size_t half = an/2, sum_length = an - half + 1;
+	if(!multiply_limbs(a, half, b, half, out, s)) return 0;
+	if(!multiply_limbs(a + half, an - half, b + half, bn - half, out + 2*half, s)) return 0;
+	uint64_t* a_sum = limb_alloc(s, sum_length);
+	uint64_t* b_sum = limb_alloc(s, sum_length);
+	uint64_t* middle = limb_alloc(s, 2*sum_length);
+	if(!middle) return 0;
+	memset(a_sum, 0, sum_length*sizeof(uint64_t));
+	memcpy(a_sum, a + half, (an - half)*sizeof(uint64_t));
+	add_limbs(a_sum, sum_length, a, half);
+	memset(b_sum, 0, sum_length*sizeof(uint64_t));
+	memcpy(b_sum, b, half*sizeof(uint64_t));
+	add_limbs(b_sum, sum_length, b + half, bn - half);
+	if(!multiply_limbs(a_sum, sum_length, b_sum, sum_length, middle, s)) return 0;
+	sub_limbs(middle, 2*sum_length, out, 2*half);
+	sub_limbs(middle, 2*sum_length, out + 2*half, an + bn - 2*half);
+	size_t room = an + bn - half;
+	add_limbs(out + half, room, middle, 2*sum_length < room ? 2*sum_length : room);
+	s->next = mark;
+	return 1;
+}
 
-	if(!rnlen) {
-		fprintf(stderr, "[CREADABLE ERROR] No number provided. Defaulting to zero.\n");
-		return;
+// 10^(19*2^k) as limbs[k]*B^zeros[k], B = 2^64: its low limbs are zeros
+// that need not be multiplied.
+struct chunk_powers {
+	const uint64_t* limbs[64];
+	size_t length[64];
+	size_t zeros[64];
+};
+
+static int square_powers(struct chunk_powers* powers, int top, struct limb_stack* s) {
+	uint64_t* first = limb_alloc(s, 1);
+	if(!first) return 0;
+	*first = BIG_CHUNK;
+	powers->limbs[0] = first;
+	powers->length[0] = 1;
+	powers->zeros[0] = 0;
+	for(int k = 1; k <= top; ++k) {
+		size_t length = 2*powers->length[k - 1];
+		uint64_t* square = limb_alloc(s, length);
+		if(!square || !multiply_limbs(powers->limbs[k - 1], powers->length[k - 1], powers->limbs[k - 1], powers->length[k - 1], square, s)) return 0;
+		size_t zeros = 2*powers->zeros[k - 1];
+		while(!square[length - 1]) --length;
+		while(!*square) ++square, --length, ++zeros;
+		powers->limbs[k] = square;
+		powers->length[k] = length;
+		powers->zeros[k] = zeros;
 	}
+	return 1;
+}
 
-	// remove trailing spaces
-	char readable_number[rnlen];
-	strcpy(readable_number, rn);
-	for(size_t i = rnlen-2; readable_number[i] == ' ' || readable_number[i] == '\t'; --i) {
-		readable_number[i] = '\0';
+// The m chunks, least significant first, as limbs in out (room for m of
+// them). Returns how many are used, or SIZE_MAX if the scratch space runs
+// out.
+static size_t chunks_to_limbs(const uint64_t* chunks, size_t m, uint64_t* out, const struct chunk_powers* powers, struct limb_stack* s) {
+	if(m <= BIG_SCHOOLBOOK_CHUNKS) {
+		size_t length = 0;
+		for(size_t i = m; i--;) length = multiply_add(out, length, BIG_CHUNK, chunks[i]);
+		return length;
 	}
-	rnlen = strlen(readable_number);
 
-	// checks
-	char leading_spaces = 1;
-	char separator = '\0';
+	// h = 2^k < m <= 2^(k + 1)
+	int k = 0;
+	while(((size_t)2 << k) < m) ++k;
+	size_t h = (size_t)1 << k;
+	size_t low_length = chunks_to_limbs(chunks, h, out, powers, s);
+	if(low_length == SIZE_MAX) return SIZE_MAX;
 
-	char* ret = malloc(sizeof(char)*rnlen);
-	if(!ret) {
-		fprintf(stderr, "[CREADABLE ERROR] Internal memory error. Defaulting to zero.\n");
-		return;
+	uint64_t* mark = s->next;
+	uint64_t* high = limb_alloc(s, m - h);
+	if(!high) return SIZE_MAX;
+	size_t high_length = chunks_to_limbs(chunks + h, m - h, high, powers, s);
+	if(high_length == SIZE_MAX) return SIZE_MAX;
+	size_t product_length = high_length + powers->length[k];
+	uint64_t* product = limb_alloc(s, product_length);
+	if(!product || !multiply_limbs(high, high_length, powers->limbs[k], powers->length[k], product, s)) return SIZE_MAX;
+
+	memset(out + low_length, 0, (m - low_length)*sizeof(uint64_t));
+	size_t zeros = powers->zeros[k];
+	add_limbs(out + zeros, m - zeros, product, product_length < m - zeros ? product_length : m - zeros);
+	s->next = mark;
+
+	size_t length = m;
+	while(length && !out[length - 1]) --length;
+	return length;
+}
+
+// The chunks of a power of two base, least significant first, are only
+// laid end to end: width bits each.
+static size_t pack_chunks(const uint64_t* chunks, size_t m, unsigned width, uint64_t* out) {
+	size_t length = (m*width + 63)/64;
+	memset(out, 0, length*sizeof(uint64_t));
+	for(size_t i = 0; i < m; ++i) {
+		size_t bit = i*width;
+		out[bit/64] |= chunks[i] << bit%64;
+		if(bit%64 + width > 64) out[bit/64 + 1] |= chunks[i] >> (64 - bit%64);
 	}
-	size_t j = 0; // cursor for ret
+	while(length && !out[length - 1]) --length;
+	return length;
+}
 
-	for(size_t i = 0; i < rnlen; ++i) {
-		switch(readable_number[i]) {
-		case '-':
-			if(!leading_spaces) {
-				fprintf(stderr, "[CREADABLE ERROR] Incorrect usage of '-' symbol. Defaulting to zero.\n");
-				free(ret);
-				return;
-			}
-			leading_spaces = 0;
-			*negative = 1;
-		break;
-		case '0':
-		case '1':
-		case '2':
-		case '3':
-		case '4':
-		case '5':
-		case '6':
-		case '7':
-		case '8':
-		case '9':
-			leading_spaces = 0;
-			ret[j++] = readable_number[i];
-		break;
-		case ' ':
-		case '\t':
-			if(!leading_spaces && separator == '\0') {
-			    separator = readable_number[i];
-			}
-		// intentional fall-through
-		case '_':
-		case ',':
-			if(readable_number[i] != ' ' && readable_number[i] != '\t') leading_spaces = 0;
-			if(separator == '\0') {
-			    separator = readable_number[i];
+CREADABLE_API size_t rbig_workspace(size_t length) {
+	// at least 16 digits a chunk, hexadecimal being the worst
+	size_t chunks = length/16 + 1;
+	if(chunks <= BIG_SCHOOLBOOK_CHUNKS) return 2*chunks + 1;
+	return 8*chunks + 64*KARATSUBA_LIMBS;
+}
+
+CREADABLE_API struct rresult rbig_ex(const char* number, size_t length, uint64_t* workspace, size_t size, struct rbig* out) {
+	*out = (struct rbig){workspace, 0, 0};
+	const char* end = number + length;
+	struct number n;
+	enum rstatus status = extract_number(&default_parser, number, end, NULL, &n);
+	if(status) return (struct rresult){status, n.error_at ? (size_t)(n.error_at - number) : 0};
+	if(n.floating) return (struct rresult){RSTATUS_FLOAT_TO_INTEGER, 0};
+	if(!n.ndigits) return (struct rresult){RSTATUS_OK, 0};
+
+	// the full chunks go down from the end of the workspace, most
+	// significant first, which leaves them least significant first; the
+	// digits left over at the end stay in `last`
+	unsigned bits = (unsigned)n.bits;
+	unsigned per_chunk = bits ? 64/bits : 19;
+	uint64_t* chunks = workspace + size;
+	size_t m = 0;
+	uint64_t last = 0;
+	unsigned filled = 0;
+	const char* p = number;
+	if(bits) {
+		unsigned base = 1u << bits;
+		for(; p != end; ++p) {
+			unsigned digit = digit_values[(unsigned char)*p];
+			// the 0 of the prefix is one of the leading zeros, its letter no digit
+			if(digit >= base || (!m && !filled && !digit)) continue;
+			last = last << bits | digit;
+			if(++filled < per_chunk) continue;
+			if(2*(m + 1) + 1 > size) return (struct rresult){RSTATUS_OVERFLOW, 0};
+			*--chunks = last;
+			++m;
+			last = 0;
+			filled = 0;
+		}
+	}
+	else {
+		while(p != end) {
+			if(*p < '0' || *p > '9') {
+				++p;
+				continue;
 			}
-			else if(separator != readable_number[i]) {
-				fprintf(
-					stderr,
-					"[CREADABLE ERROR] Incosistent usage of separators: "
-					"found '%s' while '%s' already in use. Defaulting to zero.\n",
-					readable_number[i] == ' ' ? "<space>" : (readable_number[i] == '\t' ? "<tab>" : (char[]){readable_number[i], '\0'}),
-					separator == ' ' ? "<space>" : (separator == '\t' ? "<tab>" : (char[]){separator, '\0'})
-				);
-				free(ret);
-				return;
+			size_t run = digit_run(p, end);
+			if(!m && !filled) {
+				for(; run && *p == '0'; --run) ++p;
 			}
-		break;
-		case '.':
-			if(leading_spaces || *floating) {
-				fprintf(stderr, "[CREADABLE ERROR] Incorrect usage of '.' symbol. Defaulting to zero.\n");
-				free(ret);
-				return;
+			while(run) {
+				size_t take = run < per_chunk - filled ? run : per_chunk - filled;
+				last = last*powers_of_ten[take] + digits_value(p, take);
+				p += take;
+				run -= take;
+				filled += (unsigned)take;
+				if(filled < per_chunk) continue;
+				if(2*(m + 1) + 1 > size) return (struct rresult){RSTATUS_OVERFLOW, 0};
+				*--chunks = last;
+				++m;
+				last = 0;
+				filled = 0;
 			}
-			*floating = 1;
-			ret[j++] = '.';
-		break;
-		default:
-			fprintf(
-				stderr,
-				"[CREADABLE ERROR] Invalid symbol found: '%c'. Defaulting to zero.\n",
-				readable_number[i]
-			);
-			free(ret);
-			return;
-		break;
 		}
 	}
-	ret[j] = '\0';
-	if(len) *len = j;
-	*number = ret;
+	if(2*m + 1 > size) return (struct rresult){RSTATUS_OVERFLOW, 0};
+
+	size_t count;
+	if(bits) {
+		count = pack_chunks(chunks, m, bits*per_chunk, workspace);
+	}
+	else {
+		struct limb_stack s = {workspace + m + 1, chunks};
+		struct chunk_powers powers;
+		int top = 0;
+		while(((size_t)2 << top) < m) ++top;
+		if(m > BIG_SCHOOLBOOK_CHUNKS && !square_powers(&powers, top, &s)) return (struct rresult){RSTATUS_OVERFLOW, 0};
+		count = chunks_to_limbs(chunks, m, workspace, &powers, &s);
+		if(count == SIZE_MAX) return (struct rresult){RSTATUS_OVERFLOW, 0};
+	}
+	// the digits short of a chunk: count*base^filled + last
+	if(filled) {
+		uint64_t factor = bits ? 1ULL << bits*filled : powers_of_ten[filled];
+		count = multiply_add(workspace, count, factor, last);
+	}
+	*out = (struct rbig){workspace, count, n.negative};
+	return (struct rresult){RSTATUS_OK, 0};
 }
 
-char _rchar(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
+CREADABLE_API struct rresult rbig_arena_ex(const char* number, size_t length, struct rarena* arena, struct rbig* out) {
+	size_t start = arena->used + ((0 - ((uintptr_t)arena->memory + arena->used)) & (sizeof(uint64_t) - 1));
+	if(start > arena->size) start = arena->size;
+	uint64_t* workspace = (uint64_t*)((char*)arena->memory + start);
+	struct rresult result = rbig_ex(number, length, workspace, (arena->size - start)/sizeof(uint64_t), out);
+	if(!result.status) arena->used = start + out->count*sizeof(uint64_t);
+	return result;
+}
 
-	if(!number) return 0;
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
+// ===========================
+// Per-call-site cache
+// ===========================
+
+// The r*() macros always hand the same string literal to the parser from a
+// given call site, so the literal's address identifies the call site. Each
+// thread keeps its own direct-mapped table of the last results, which needs
+// no locking and never grows past CREADABLE_CACHE_SIZE entries.
+// Parse errors are reported once, then the cached zero is returned.
+#ifndef CREADABLE_CACHE_SIZE
+#define CREADABLE_CACHE_SIZE 256 // must be a power of two
+#endif
+
+enum cache_type {
+	CACHE_NONE,
+	CACHE_CHAR, CACHE_SCHAR, CACHE_UCHAR,
+	CACHE_SHORT, CACHE_USHORT,
+	CACHE_INT, CACHE_UINT,
+	CACHE_LONG, CACHE_LONGLONG, CACHE_ULONG, CACHE_ULONGLONG,
+	CACHE_FLOAT,
+	CACHE_DOUBLE, CACHE_LONGDOUBLE
+};
+
+struct cache_entry {
+	const char* key;
+	enum cache_type tag;
+	union {
+		long long i;
+		unsigned long long u;
+		float f;
+		double d;
+		long double ld;
+	} value;
+};
+
+static _Thread_local struct cache_entry cache[CREADABLE_CACHE_SIZE];
+
+static struct cache_entry* cache_slot(const char* key, enum cache_type tag) {
+	uintptr_t hash = ((uintptr_t)key ^ (uintptr_t)tag) * (uintptr_t)0x9E3779B97F4A7C15ULL;
+	return &cache[(hash >> 16) & (CREADABLE_CACHE_SIZE - 1)];
+}
+
+#define CACHED(name, type, cache_tag, field) \
+	CREADABLE_API type _r##name##_cached(char* readable_number) { \
+		struct cache_entry* entry = cache_slot(readable_number, cache_tag); \
+		if(entry->key == readable_number && entry->tag == cache_tag) return (type)entry->value.field; \
+		type ret = _r##name(readable_number); \
+		entry->key = readable_number; \
+		entry->tag = cache_tag; \
+		entry->value.field = ret; \
+		return ret; \
 	}
 
-	char ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		char digit = number[i] - '0';
-		if(negative) digit = -digit;
+CACHED(char, char, CACHE_CHAR, i)
+CACHED(schar, signed char, CACHE_SCHAR, i)
+CACHED(uchar, unsigned char, CACHE_UCHAR, u)
 
-		if(ret > CHAR_MAX/10 || (ret == CHAR_MAX/10 && digit > CHAR_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows char type. Defaulting to zero.\n", number);
-			return 0;
-		}
-		if(ret < CHAR_MIN/10 || (ret == CHAR_MIN/10 && digit < CHAR_MIN%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s underflows char type. Defaulting to zero.\n", number);
-			return 0;
-		}
-		ret = ret*10 + digit;
+CACHED(short, short, CACHE_SHORT, i)
+CACHED(ushort, unsigned short, CACHE_USHORT, u)
+
+CACHED(int, int, CACHE_INT, i)
+CACHED(uint, unsigned int, CACHE_UINT, u)
+
+CACHED(long, long, CACHE_LONG, i)
+CACHED(longlong, long long, CACHE_LONGLONG, i)
+CACHED(ulong, unsigned long, CACHE_ULONG, u)
+CACHED(ulonglong, unsigned long long, CACHE_ULONGLONG, u)
+
+CACHED(float, float, CACHE_FLOAT, f)
+
+CACHED(double, double, CACHE_DOUBLE, d)
+CACHED(longdouble, long double, CACHE_LONGDOUBLE, ld)
+
+// ===========================
+// Threads
+// ===========================
+
+// Runs work() on `count` argument structs of `size` bytes each, one thread
+// per struct, the first one on the calling thread. If a thread cannot be
+// started its share runs on the calling thread after the others.
+#define MAX_THREADS 256
+
+static void run_threads(void* (*work)(void*), void* args, size_t size, unsigned count) {
+	pthread_t workers[MAX_THREADS];
+	char started[MAX_THREADS] = {0};
+
+	for(unsigned t = 1; t < count; ++t) {
+		started[t] = pthread_create(&workers[t], NULL, work, (char*)args + t*size) == 0;
 	}
+	work(args);
+	for(unsigned t = 1; t < count; ++t) {
+		if(started[t]) pthread_join(workers[t], NULL);
+		else work((char*)args + t*size);
+	}
+}
 
-	free(number);
-	return ret;
+static unsigned clamp_threads(unsigned threads, size_t work) {
+	if(threads > MAX_THREADS) threads = MAX_THREADS;
+	if(threads > work) threads = (unsigned)work;
+	return threads < 1 ? 1 : threads;
 }
-signed char _rschar(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
 
-	if(!number) return 0;
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
+// ===========================
+// Type table
+// ===========================
+
+typedef enum rstatus (*element_parser)(const char* readable_number, const char* end, struct number* n, void* out);
+typedef enum rstatus (*element_converter)(struct number* n, void* out);
+
+#define ELEMENT(name, type) \
+	static enum rstatus parse_element_##name(const char* readable_number, const char* end, struct number* n, void* out) { \
+		return parse_##name(&default_parser, readable_number, end, NULL, n, (type*)out); \
+	} \
+	static enum rstatus convert_element_##name(struct number* n, void* out) { \
+		return convert_##name(n, (type*)out); \
 	}
 
-	signed char ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		signed char digit = (signed char)(number[i] - '0');
-		if(negative) digit = -digit;
+ELEMENT(char, char)
+ELEMENT(schar, signed char)
+ELEMENT(uchar, unsigned char)
 
-		if(ret > SCHAR_MAX/10 || (ret == SCHAR_MAX/10 && digit > SCHAR_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows signed char type. Defaulting to zero.\n", number);
-			return 0;
-		}
-		if(ret < SCHAR_MIN/10 || (ret == SCHAR_MIN/10 && digit < SCHAR_MIN%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s underflows signed char type. Defaulting to zero.\n", number);
-			return 0;
-		}
-		ret = ret*10 + digit;
+ELEMENT(short, short)
+ELEMENT(ushort, unsigned short)
+
+ELEMENT(int, int)
+ELEMENT(uint, unsigned int)
+
+ELEMENT(long, long)
+ELEMENT(longlong, long long)
+ELEMENT(ulong, unsigned long)
+ELEMENT(ulonglong, unsigned long long)
+
+ELEMENT(float, float)
+
+ELEMENT(double, double)
+ELEMENT(longdouble, long double)
+
+// indexed by enum rtype
+static const struct {
+	size_t size;
+	element_parser parse;
+	element_converter convert;
+} types[] = {
+	{sizeof(char), parse_element_char, convert_element_char},
+	{sizeof(signed char), parse_element_schar, convert_element_schar},
+	{sizeof(unsigned char), parse_element_uchar, convert_element_uchar},
+	{sizeof(short), parse_element_short, convert_element_short},
+	{sizeof(unsigned short), parse_element_ushort, convert_element_ushort},
+	{sizeof(int), parse_element_int, convert_element_int},
+	{sizeof(unsigned int), parse_element_uint, convert_element_uint},
+	{sizeof(long), parse_element_long, convert_element_long},
+	{sizeof(long long), parse_element_longlong, convert_element_longlong},
+	{sizeof(unsigned long), parse_element_ulong, convert_element_ulong},
+	{sizeof(unsigned long long), parse_element_ulonglong, convert_element_ulonglong},
+	{sizeof(float), parse_element_float, convert_element_float},
+	{sizeof(double), parse_element_double, convert_element_double},
+	{sizeof(long double), parse_element_longdouble, convert_element_longdouble}
+};
+
+// ===========================
+// Batch parsing
+// ===========================
+
+struct batch_range {
+	const char* const* numbers;
+	char* out;
+	enum rtype type;
+	uint8_t* status;
+	size_t begin;
+	size_t end;
+	size_t failed;
+};
+
+static void* parse_range(void* arg) {
+	struct batch_range* range = arg;
+	size_t size = types[range->type].size;
+	element_parser parse = types[range->type].parse;
+	struct number n;
+
+	range->failed = 0;
+	for(size_t i = range->begin; i < range->end; ++i) {
+		enum rstatus status = parse(range->numbers[i], NULL, &n, range->out + i*size);
+		if(status) ++range->failed;
+		if(range->status) range->status[i] = (uint8_t)status;
 	}
-	
-	free(number);
-	return ret;
+	return NULL;
 }
-unsigned char _ruchar(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
 
-	if(!number) return 0;
-	if(negative) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign negative number to unsigned type. Defaulting to zero.\n");
-		return 0;
+// Threads get contiguous slices so they never write next to each other
+// except at the slice boundaries.
+static size_t parse_batch(const char* const* numbers, size_t count, void* out, enum rtype type, uint8_t* status, unsigned threads) {
+	struct batch_range ranges[MAX_THREADS];
+	threads = clamp_threads(threads, count);
+	for(unsigned t = 0; t < threads; ++t) {
+		ranges[t] = (struct batch_range){numbers, out, type, status, count*t/threads, count*(t + 1)/threads, 0};
 	}
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
+	run_threads(parse_range, ranges, sizeof(*ranges), threads);
+
+	size_t failed = 0;
+	for(unsigned t = 0; t < threads; ++t) failed += ranges[t].failed;
+	return failed;
+}
+
+#define BATCH(name, type, tag) \
+	CREADABLE_API size_t rparse_batch_##name(const char* const* numbers, size_t count, type* out, uint8_t* status, unsigned threads) { \
+		return parse_batch(numbers, count, out, tag, status, threads); \
 	}
 
-	unsigned char ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		unsigned char digit = (unsigned char)(number[i] - '0');
-		if(ret > UCHAR_MAX/10 || (ret == UCHAR_MAX/10 && digit > UCHAR_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows unsigned char type. Defaulting to zero.\n", number);
-			return 0;
-		}
-		ret = ret*10 + digit;
+BATCH(char, char, RTYPE_CHAR)
+BATCH(schar, signed char, RTYPE_SCHAR)
+BATCH(uchar, unsigned char, RTYPE_UCHAR)
+
+BATCH(short, short, RTYPE_SHORT)
+BATCH(ushort, unsigned short, RTYPE_USHORT)
+
+BATCH(int, int, RTYPE_INT)
+BATCH(uint, unsigned int, RTYPE_UINT)
+
+BATCH(long, long, RTYPE_LONG)
+BATCH(longlong, long long, RTYPE_LONGLONG)
+BATCH(ulong, unsigned long, RTYPE_ULONG)
+BATCH(ulonglong, unsigned long long, RTYPE_ULONGLONG)
+
+BATCH(float, float, RTYPE_FLOAT)
+
+BATCH(double, double, RTYPE_DOUBLE)
+BATCH(longdouble, long double, RTYPE_LONGDOUBLE)
+
+// ===========================
+// File ingestion
+// ===========================
+
+// The file is mapped, cut into one chunk per thread on record boundaries,
+// and each field is parsed in place straight from the mapping. A first
+// parallel pass counts the records of every chunk so each thread knows the
+// row its chunk starts at.
+struct file_chunk {
+	const char* begin;
+	const char* end;
+	size_t first_row;
+	size_t rows;
+
+	char delimiter;
+	const struct rcolumn* columns;
+	size_t ncolumns;
+	size_t max_rows;
+	unsigned char* row_errors;
+	// the bitmap bytes shared with the neighbouring chunks are merged by
+	// the calling thread once every worker is done
+	size_t first_byte, last_byte;
+	unsigned char first_bits, last_bits;
+};
+
+static void* count_records(void* arg) {
+	struct file_chunk* chunk = arg;
+	chunk->rows = 0;
+	for(const char* p = chunk->begin; p < chunk->end; ++chunk->rows) {
+		const char* newline = memchr(p, '\n', (size_t)(chunk->end - p));
+		p = newline ? newline + 1 : chunk->end;
 	}
-	
-	free(number);
-	return ret;
+	return NULL;
 }
-short _rshort(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
 
-	if(!number) return 0;
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
-	}
+static void flag_row(struct file_chunk* chunk, size_t row) {
+	unsigned char bit = (unsigned char)(1u << (row % 8));
+	size_t byte = row/8;
+	if(byte == chunk->first_byte) chunk->first_bits |= bit;
+	else if(byte == chunk->last_byte) chunk->last_bits |= bit;
+	else chunk->row_errors[byte] |= bit;
+}
 
-	short ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		short digit = (short)(number[i] - '0');
-		if(negative) digit = -digit;
+static void* parse_records(void* arg) {
+	struct file_chunk* chunk = arg;
+	struct number n;
+	size_t row = chunk->first_row;
 
-		if(ret > SHRT_MAX/10 || (ret == SHRT_MAX/10 && digit > SHRT_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows short type. Defaulting to zero.\n", number);
-			return 0;
+	for(const char* p = chunk->begin; p < chunk->end && row < chunk->max_rows; ++row) {
+		const char* newline = memchr(p, '\n', (size_t)(chunk->end - p));
+		const char* line_end = newline ? newline : chunk->end;
+		if(line_end > p && line_end[-1] == '\r') --line_end;
+
+		char failed = 0;
+		size_t column = 0;
+		for(const char* field = p; field <= line_end; ++column) {
+			const char* field_end = memchr(field, chunk->delimiter, (size_t)(line_end - field));
+			if(!field_end) field_end = line_end;
+
+			if(column >= chunk->ncolumns) {
+				failed = 1;
+				break;
+			}
+			const struct rcolumn* c = &chunk->columns[column];
+			if(c->type != RTYPE_SKIP) {
+				char* out = (char*)c->values + row*types[c->type].size;
+				if(types[c->type].parse(field, field_end, &n, out)) failed = 1;
+			}
+			field = field_end + 1;
 		}
-		if(ret < SHRT_MIN/10 || (ret == SHRT_MIN/10 && digit < SHRT_MIN%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s underflows short type. Defaulting to zero.\n", number);
-			return 0;
+		if(column < chunk->ncolumns) {
+			// missing fields are left at zero
+			for(; column < chunk->ncolumns; ++column) {
+				const struct rcolumn* c = &chunk->columns[column];
+				if(c->type != RTYPE_SKIP) memset((char*)c->values + row*types[c->type].size, 0, types[c->type].size);
+			}
+			failed = 1;
 		}
-		ret = ret*10 + digit;
+		if(failed && chunk->row_errors) flag_row(chunk, row);
+
+		p = newline ? newline + 1 : chunk->end;
 	}
-	
-	free(number);
-	return ret;
+	return NULL;
 }
-unsigned short _rushort(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
 
-	if(!number) return 0;
-	if(negative) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign negative number to unsigned type. Defaulting to zero.\n");
-		return 0;
-	}
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
+// The one rule for rparse_file(), rindex_fields(), rparse_delimited() and
+// rstream_init(): the delimiter can be neither part of a number nor one of
+// its separators. They all take lengths, so a NUL is a delimiter like any
+// other byte.
+static int delimiter_allowed(char delimiter) {
+	if(delimiter == '\0') return 1;
+	if((delimiter >= '0' && delimiter <= '9') || delimiter == '.' || delimiter == '-' || delimiter == '+' ||
+		delimiter == 'e' || delimiter == 'E' || delimiter == '_' || delimiter == ',' || delimiter == ' ' || delimiter == '\t') {
+		char buf[2];
+		emit_error(RSTATUS_INVALID_ARGUMENT, "[CREADABLE ERROR] '%s' cannot be used as delimiter.", separator_name(delimiter, buf));
 		return 0;
 	}
+	return 1;
+}
 
-	unsigned short ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		unsigned short digit = (unsigned short)(number[i] - '0');
-		if(ret > USHRT_MAX/10 || (ret == USHRT_MAX/10 && digit > USHRT_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows unsigned short type. Defaulting to zero.\n", number);
-			return 0;
+CREADABLE_API long long rparse_file(const char* path, char delimiter, const struct rcolumn* columns, size_t ncolumns, size_t max_rows, unsigned char* row_errors, unsigned threads) {
+	if(!delimiter_allowed(delimiter)) return -1;
+	if(delimiter == '\n') {
+		emit_error(RSTATUS_INVALID_ARGUMENT, "[CREADABLE ERROR] A line break cannot be used as field delimiter.");
+		return -1;
+	}
+	for(size_t c = 0; c < ncolumns; ++c) {
+		if(columns[c].type > RTYPE_SKIP) {
+			emit_error(RSTATUS_INVALID_ARGUMENT, "[CREADABLE ERROR] Unknown type for column %zu.", c);
+			return -1;
 		}
-		ret = ret*10 + digit;
 	}
-	
-	free(number);
-	return ret;
-}
-int _rint(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
 
-	if(!number) return 0;
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
+	int fd = open(path, O_RDONLY);
+	if(fd < 0) {
+		emit_error(RSTATUS_IO_ERROR, "[CREADABLE ERROR] Cannot open %s.", path);
+		return -1;
 	}
+	struct stat st;
+	if(fstat(fd, &st) < 0) {
+		emit_error(RSTATUS_IO_ERROR, "[CREADABLE ERROR] Cannot read %s.", path);
+		close(fd);
+		return -1;
+	}
+	size_t size = (size_t)st.st_size;
+	const char* data = NULL;
+	if(size) {
+		data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(data == MAP_FAILED) {
+			emit_error(RSTATUS_IO_ERROR, "[CREADABLE ERROR] Cannot map %s.", path);
+			close(fd);
+			return -1;
+		}
+		posix_madvise((void*)data, size, POSIX_MADV_SEQUENTIAL);
+	}
+	close(fd);
 
-	int ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		int digit = (int)(number[i] - '0');
-		if(negative) digit = -digit;
+	if(row_errors) memset(row_errors, 0, (max_rows + 7)/8);
 
-		if(ret > INT_MAX/10 || (ret == INT_MAX/10 && digit > INT_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows int type. Defaulting to zero.\n", number);
-			return 0;
+	struct file_chunk chunks[MAX_THREADS];
+	threads = clamp_threads(threads, size);
+	const char* begin = data;
+	for(unsigned t = 0; t < threads; ++t) {
+		const char* end = data + size*(t + 1)/threads;
+		if(end < begin) end = begin;
+		if(t + 1 < threads && end > data && end[-1] != '\n') {
+			const char* newline = memchr(end, '\n', (size_t)(data + size - end));
+			end = newline ? newline + 1 : data + size;
 		}
-		if(ret < INT_MIN/10 || (ret == INT_MIN/10 && digit < INT_MIN%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s underflows int type. Defaulting to zero.\n", number);
-		}
-		ret = ret*10 + digit;
+		chunks[t] = (struct file_chunk){begin, end, 0, 0, delimiter, columns, ncolumns, max_rows, row_errors, 0, 0, 0, 0};
+		begin = end;
 	}
-	
-	free(number);
-	return ret;
-}
-unsigned int _ruint(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
 
-	if(!number) return 0;
-	if(negative) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign negative number to unsigned type. Defaulting to zero.\n");
-		return 0;
-	}
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
+	run_threads(count_records, chunks, sizeof(*chunks), threads);
+	size_t total = 0;
+	for(unsigned t = 0; t < threads; ++t) {
+		chunks[t].first_row = total;
+		total += chunks[t].rows;
+		size_t last_row = chunks[t].first_row + chunks[t].rows;
+		chunks[t].first_byte = chunks[t].first_row/8;
+		chunks[t].last_byte = last_row ? (last_row - 1)/8 : 0;
 	}
 
-	unsigned int ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		unsigned int digit = (unsigned int)(number[i] - '0');
-		if(ret > UINT_MAX/10 || (ret == UINT_MAX/10 && digit > UINT_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows int type. Defaulting to zero.\n", number);
-			return 0;
+	run_threads(parse_records, chunks, sizeof(*chunks), threads);
+	if(row_errors) {
+		for(unsigned t = 0; t < threads; ++t) {
+			if(chunks[t].first_row < max_rows) row_errors[chunks[t].first_byte] |= chunks[t].first_bits;
+			if(chunks[t].rows && chunks[t].last_byte*8 < max_rows) row_errors[chunks[t].last_byte] |= chunks[t].last_bits;
 		}
-		ret = ret*10 + digit;
 	}
-	
-	free(number);
-	return ret;
+
+	if(data) munmap((void*)data, size);
+	return (long long)total;
 }
-long _rlong(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
 
-	if(!number) return 0;
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
-	}
+// ===========================
+// Delimited buffers
+// ===========================
 
-	long ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		long digit = (long)(number[i] - '0');
-		if(negative) digit = -digit;
+// Two passes, as simdjson does: the first turns every 64-byte block into a
+// bit mask of its delimiters and writes out the positions of the set bits,
+// the second parses each field between two of them in place. The
+// delimiter can be neither part of a number nor one of its separators
+// (see delimiter_allowed), so the first pass never has to look at what is
+// between delimiters.
 
-		if(ret > LONG_MAX/10 || (ret == LONG_MAX/10 && digit > LONG_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows long type. Defaulting to zero.\n", number);
-			return 0;
+static int trailing_zeroes(uint64_t m) {
+#if defined(__GNUC__)
+	return __builtin_ctzll(m);
+#else
+	int count = 0;
+	while(!(m & 1)) m >>= 1, ++count;
+	return count;
+#endif
+}
+
+static int count_ones(uint64_t m) {
+#if defined(__GNUC__)
+	return __builtin_popcountll(m);
+#else
+	int count = 0;
+	for(; m; m &= m - 1) ++count;
+	return count;
+#endif
+}
+
+// Writes where each field of buffer ends to ends[], at most max of them,
+// and returns how many it wrote; with ends NULL it counts all of them.
+static size_t index_fields(const char* buffer, size_t length, char delimiter, size_t* ends, size_t max) {
+	size_t count = 0;
+	for(size_t i = 0; i < length; i += 64) {
+		uint64_t m;
+		if(length - i >= 64) {
+			m = kernels->match(buffer + i, delimiter);
+		}
+		else {
+			// padded with a byte that is never the delimiter
+			char block[64];
+			memset(block, '0', sizeof(block));
+			memcpy(block, buffer + i, length - i);
+			m = kernels->match(block, delimiter);
+		}
+		if(!ends) {
+			count += (size_t)count_ones(m);
+			continue;
 		}
-		if(ret < LONG_MIN/10 || (ret == LONG_MIN/10 && digit < LONG_MIN%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s underflows long type. Defaulting to zero.\n", number);
+		for(; m; m &= m - 1) {
+			if(count == max) return count;
+			ends[count++] = i + (size_t)trailing_zeroes(m);
 		}
-		ret = ret*10 + digit;
 	}
-	
-	free(number);
-	return ret;
-}
-long long _rlonglong(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
-
-	if(!number) return 0;
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
+	// the last field, unless the buffer ends with a delimiter
+	if(length && buffer[length - 1] != delimiter) {
+		if(!ends) ++count;
+		else if(count < max) ends[count++] = length;
 	}
+	return count;
+}
 
-	long long ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		long long digit = (long long)(number[i] - '0');
-		if(negative) digit = -digit;
+// The usual integer field, an optional '-' and at most 19 digits grouped
+// or not by '_' or ',', needs none of extract_number's rules: its magnitude
+// goes straight to the type's range check. Anything else, errors included,
+// is left to the full parser.
+static int scan_integer_field(const char* p, const char* end, struct number* n) {
+	n->negative = p != end && *p == '-';
+	p += n->negative;
 
-		if(ret > LLONG_MAX/10 || (ret == LLONG_MAX/10 && digit > LLONG_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows long long type. Defaulting to zero.\n", number);
+	uint64_t value = 0;
+	unsigned digits = 0;
+	char separator = '\0';
+	for(; p != end; ++p) {
+		unsigned digit = (unsigned)(unsigned char)*p - '0';
+		if(digit < 10) {
+			if(++digits > 19) return 0;
+			value = value*10 + digit;
+		}
+		else if((*p == '_' || *p == ',') && (!separator || separator == *p)) {
+			separator = *p;
+		}
+		else {
 			return 0;
 		}
-		if(ret < LLONG_MIN/10 || (ret == LLONG_MIN/10 && digit < LLONG_MIN%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s underflows long long type. Defaulting to zero.\n", number);
+	}
+	n->value = value;
+	n->overflow = 0;
+	n->floating = 0;
+	n->bits = 0;
+	return digits != 0;
+}
+
+// A '\r' is only ignored at the end of a line, as rparse_file() and
+// rstream_feed() do: when lines are the fields.
+static size_t parse_fields(const char* buffer, const size_t* ends, size_t count, char delimiter, enum rtype type, void* out, uint8_t* status) {
+	size_t size = types[type].size;
+	element_parser parse = types[type].parse;
+	element_converter convert = types[type].convert;
+	int integer = type < RTYPE_FLOAT;
+	struct number n;
+	size_t failed = 0;
+	size_t begin = 0;
+	for(size_t i = 0; i < count; ++i) {
+		size_t end = ends[i];
+		if(delimiter == '\n' && end > begin && buffer[end - 1] == '\r') --end;
+		enum rstatus result;
+		STATS_START();
+		if(integer && scan_integer_field(buffer + begin, buffer + end, &n)) {
+			result = convert(&n, (char*)out + i*size);
+			STATS_RECORD(type, buffer + begin, buffer + end, result);
+		}
+		else {
+			result = parse(buffer + begin, buffer + end, &n, (char*)out + i*size);
 		}
-		ret = ret*10 + digit;
+		if(result) ++failed;
+		if(status) status[i] = (uint8_t)result;
+		begin = ends[i] + 1;
 	}
-	
-	free(number);
-	return ret;
+	return failed;
 }
-unsigned long _rulong(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
 
-	if(!number) return 0;
-	if(negative) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign negative number to unsigned type. Defaulting to zero.\n");
-		return 0;
+CREADABLE_API long long rindex_fields(const char* buffer, size_t length, char delimiter, size_t* ends, size_t max_fields) {
+	if(!delimiter_allowed(delimiter)) return -1;
+	size_t found = index_fields(buffer, length, delimiter, ends, max_fields);
+	if(found < max_fields) return (long long)found;
+	// only counted from here on
+	size_t from = found ? ends[found - 1] + 1 : 0;
+	if(from > length) return (long long)found;
+	return (long long)(found + index_fields(buffer + from, length - from, delimiter, NULL, 0));
+}
+
+CREADABLE_API size_t rparse_fields(const char* buffer, const size_t* ends, size_t count, char delimiter, enum rtype type, void* out, uint8_t* status) {
+	if(type >= RTYPE_SKIP) {
+		emit_error(RSTATUS_INVALID_ARGUMENT, "[CREADABLE ERROR] Unknown type for fields.");
+		if(status) memset(status, RSTATUS_INVALID_ARGUMENT, count);
+		return count;
 	}
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
+	return parse_fields(buffer, ends, count, delimiter, type, out, status);
+}
+
+// The index is built and used a block of fields at a time, so that it
+// stays in the cache between the two passes.
+CREADABLE_API long long rparse_delimited(const char* buffer, size_t length, char delimiter, enum rtype type, void* out, size_t max_fields, uint8_t* status) {
+	if(!delimiter_allowed(delimiter)) return -1;
+	if(type >= RTYPE_SKIP) {
+		emit_error(RSTATUS_INVALID_ARGUMENT, "[CREADABLE ERROR] Unknown type for fields.");
+		return -1;
 	}
 
-	unsigned long ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		unsigned long digit = (unsigned long)(number[i] - '0');
-		if(ret > ULONG_MAX/10 || (ret == ULONG_MAX/10 && digit > ULONG_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows unsigned long type. Defaulting to zero.\n", number);
-			return 0;
-		}
-		ret = ret*10 + digit;
+	size_t ends[1024];
+	size_t fields = 0, from = 0;
+	while(fields < max_fields) {
+		size_t block = max_fields - fields < 1024 ? max_fields - fields : 1024;
+		size_t found = index_fields(buffer + from, length - from, delimiter, ends, block);
+		parse_fields(buffer + from, ends, found, delimiter, type, (char*)out + fields*types[type].size, status ? status + fields : NULL);
+		fields += found;
+		if(found < block) return (long long)fields;
+		from += ends[found - 1] + 1;
+		if(from > length) return (long long)fields;
 	}
-	
-	free(number);
-	return ret;
+	// past max_fields they are only counted
+	return (long long)(fields + index_fields(buffer + from, length - from, delimiter, NULL, 0));
 }
-unsigned long long _rulonglong(char* readable_number) {
-	char* number;
-	size_t len;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, &len, &negative, &floating);
 
-	if(!number) return 0;
-	if(negative) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign negative number to unsigned type. Defaulting to zero.\n");
-		return 0;
-	}
-	if(floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign floating point number to integer type. Defaulting to zero.\n");
-		return 0;
+// ===========================
+// Streaming
+// ===========================
+
+// The stream runs the extract_number rules (and extract_radix's after 0x,
+// 0o or 0b) one byte at a time, with their locals kept in the state so a
+// chunk can end anywhere. The lookaheads of extract_number become
+// lookbehinds: a leading 0 only turns into a prefix once the base letter
+// arrives, and a whitespace run is only checked as a separator once
+// something else follows it. A run is summed up by its first byte and the
+// first byte unlike it, which is all use_separator() would look at.
+union element {
+	char c;
+	signed char sc;
+	unsigned char uc;
+	short s;
+	unsigned short us;
+	int i;
+	unsigned int ui;
+	long l;
+	long long ll;
+	unsigned long ul;
+	unsigned long long ull;
+	float f;
+	double d;
+	long double ld;
+};
+
+struct stream_state {
+	enum rtype type;
+	char delimiter;
+	rstream_callback callback;
+	void* context;
+	size_t index;     // numbers completed so far
+	size_t offset;    // bytes of the current number so far
+
+	// first error in the current number, the rest of it is only skipped
+	enum rstatus status;
+	size_t error_at;
+
+	char leading_spaces;
+	char point;
+	char sticky;
+	char leading_zero;    // the last byte was a first 0, which a base letter makes a prefix
+	char carriage;        // a '\r' is pending: it is ignored if the delimiter follows
+	unsigned bits;        // after 0x, 0o or 0b
+	size_t prefix_at;     // offset of the base letter
+	size_t total_digits;
+
+	size_t whitespace;    // length of the pending whitespace run
+	size_t whitespace_at;
+	size_t mismatch_at;   // first byte of the run unlike its first one, 0 if none
+	char whitespace_first;
+
+	char exponent_symbol;
+	char exponent_sign;
+	size_t exponent_at;
+	size_t exponent_digits;
+	long exponent;
+
+	struct number n;
+};
+
+_Static_assert(sizeof(struct stream_state) <= sizeof(((rstream_t*)0)->state), "rstream_t is too small");
+
+static void stream_reset(struct stream_state* s) {
+	s->offset = 0;
+	s->status = RSTATUS_OK;
+	s->error_at = 0;
+	s->leading_spaces = 1;
+	s->point = 0;
+	s->sticky = 0;
+	s->leading_zero = 0;
+	s->carriage = 0;
+	s->bits = 0;
+	s->total_digits = 0;
+	s->whitespace = 0;
+	s->exponent_symbol = 0;
+	s->exponent_sign = 0;
+	s->exponent_digits = 0;
+	s->exponent = 0;
+
+	struct number* n = &s->n;
+	n->value = 0;
+	n->overflow = 0;
+	n->negative = 0;
+	n->floating = 0;
+	n->bits = 0;
+	n->exponent = 0;
+	n->ndigits = 0;
+	n->error_at = NULL;
+	n->separator = '\0';
+}
+
+static enum rstatus stream_separator(struct stream_state* s, char separator) {
+	if(s->n.separator == '\0') s->n.separator = separator;
+	else if(s->n.separator != separator) return RSTATUS_SEPARATOR_MISMATCH;
+	return RSTATUS_OK;
+}
+
+// The byte at s->offset.
+static void stream_byte(struct stream_state* s, char c) {
+	#define FAIL(status_, at_) do { \
+		s->status = (status_); \
+		s->error_at = (at_); \
+		return; \
+	} while(0)
+
+	size_t at = s->offset++;
+	if(s->status) return;
+	unsigned char class = default_parser.classes[(unsigned char)c];
+
+	if(s->leading_zero) {
+		s->leading_zero = 0;
+		unsigned bits = radix_bits(c);
+		if(bits) {
+			// the 0 was counted as a decimal digit, the prefix counts its own
+			s->bits = bits;
+			s->n.bits = (char)bits;
+			s->prefix_at = at;
+			s->total_digits = 0;
+			return;
+		}
 	}
 
-	unsigned long long ret = 0;
-	for(size_t i = 0; i < len; ++i) {
-		unsigned long long digit = (unsigned long long)(number[i] - '0');
-		if(ret > ULLONG_MAX/10 || (ret == ULLONG_MAX/10 && digit > ULLONG_MAX%10)) {
-			fprintf(stderr, "[CREADABLE ERROR] %s overflows unsigned long long type. Defaulting to zero.\n", number);
-			return 0;
+	if(class == CLASS_SPACE) {
+		if(!s->whitespace++) {
+			s->whitespace_at = at;
+			s->whitespace_first = c;
+			s->mismatch_at = 0;
+		}
+		else if(c != s->whitespace_first && !s->mismatch_at) {
+			s->mismatch_at = at;
 		}
-		ret = ret*10 + digit;
+		return;
+	}
+	if(s->whitespace) {
+		s->whitespace = 0;
+		if(stream_separator(s, s->whitespace_first)) FAIL(RSTATUS_SEPARATOR_MISMATCH, s->whitespace_at);
+		if(s->mismatch_at) FAIL(RSTATUS_SEPARATOR_MISMATCH, s->mismatch_at);
 	}
-	
-	free(number);
-	return ret;
-}
-float _rfloat(char* readable_number) {
-	char* number;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, NULL, &negative, &floating);
 
-	if(!number) return 0.0;
-	if(!floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign integer number to floating point type. Defaulting to zero.\n");
-		return 0.0;
+	struct number* n = &s->n;
+	if(s->bits) {
+		unsigned digit = digit_values[(unsigned char)c];
+		if(digit < 1u << s->bits) {
+			++s->total_digits;
+			// leading zeros are dropped, past 128 significant digits
+			// every type overflows
+			if((n->ndigits || digit) && n->ndigits < 129) n->digits[n->ndigits++] = (char)digit;
+			return;
+		}
+		switch(class) {
+		case CLASS_SEPARATOR:
+			if(stream_separator(s, c)) FAIL(RSTATUS_SEPARATOR_MISMATCH, at);
+		break;
+		case CLASS_MINUS:
+		case CLASS_EXPONENT_PLUS:
+		case CLASS_POINT:
+			FAIL(RSTATUS_MISPLACED_SYMBOL, at);
+		break;
+		default:
+			FAIL(RSTATUS_INVALID_SYMBOL, at);
+		break;
+		}
+		return;
 	}
 
-	float ret = strtof(number, NULL);
-	if(negative) ret = -ret;
+	switch(class) {
+	case CLASS_MINUS:
+	case CLASS_EXPONENT_PLUS:
+		if(s->exponent_symbol && !s->exponent_sign && !s->exponent_digits) {
+			s->exponent_sign = c;
+			break;
+		}
+		if(class == CLASS_EXPONENT_PLUS || !s->leading_spaces) FAIL(RSTATUS_MISPLACED_SYMBOL, at);
+		s->leading_spaces = 0;
+		n->negative = 1;
+	break;
+	case CLASS_DIGIT: {
+		unsigned digit = (unsigned)(c - '0');
+		s->leading_spaces = 0;
 
-	free(number);
-	return ret;
+		if(s->exponent_symbol) {
+			++s->exponent_digits;
+			if(s->exponent < 100000) s->exponent = s->exponent*10 + digit;
+			break;
+		}
+
+		if(!digit && !s->total_digits && !s->point) s->leading_zero = 1;
+		++s->total_digits;
+		if(n->ndigits == 0 && digit == 0) {
+			if(s->point) --n->exponent;
+		}
+		else if(n->ndigits < CREADABLE_MAX_DIGITS) {
+			n->digits[n->ndigits++] = c;
+			if(s->point) --n->exponent;
+		}
+		else {
+			if(digit) s->sticky = 1;
+			if(!s->point) ++n->exponent;
+		}
+	}
+	break;
+	case CLASS_SEPARATOR:
+		s->leading_spaces = 0;
+		if(stream_separator(s, c)) FAIL(RSTATUS_SEPARATOR_MISMATCH, at);
+	break;
+	case CLASS_POINT:
+		if(s->leading_spaces || s->point || s->exponent_symbol) FAIL(RSTATUS_MISPLACED_SYMBOL, at);
+		s->point = 1;
+		n->floating = 1;
+	break;
+	case CLASS_EXPONENT:
+		if(!s->total_digits || s->exponent_symbol) FAIL(RSTATUS_MISPLACED_SYMBOL, at);
+		s->exponent_symbol = 1;
+		s->exponent_at = at;
+		n->floating = 1;
+	break;
+	default:
+		FAIL(RSTATUS_INVALID_SYMBOL, at);
+	break;
+	}
+	#undef FAIL
 }
-double _rdouble(char* readable_number) {
-	char* number;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, NULL, &negative, &floating);
 
-	if(!number) return 0.0;
-	if(!floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign integer number to floating point type. Defaulting to zero.\n");
-		return 0.0;
+// What extract_number does once it reaches the end of the number.
+static enum rstatus stream_end(struct stream_state* s) {
+	struct number* n = &s->n;
+	if(s->status) return s->status;
+	if(s->bits) {
+		if(!s->total_digits) {
+			s->error_at = s->prefix_at;
+			return s->status = RSTATUS_MISPLACED_SYMBOL;
+		}
+		convert_radix(n, s->bits);
+		return RSTATUS_OK;
 	}
-	
-	double ret = strtod(number, NULL);
-	if(negative) ret = -ret;
+	if(!s->total_digits) return RSTATUS_EMPTY;
+	if(s->exponent_symbol && !s->exponent_digits) {
+		s->error_at = s->exponent_at;
+		return s->status = RSTATUS_MISSING_EXPONENT;
+	}
+	if(s->sticky) n->digits[n->ndigits++] = '1', --n->exponent;
+	n->exponent += (int)(s->exponent_sign == '-' ? -s->exponent : s->exponent);
+	if(!n->floating) convert_integer(n);
+	return RSTATUS_OK;
+}
 
-	free(number);
-	return ret;
+static void stream_emit(struct stream_state* s) {
+	union element value;
+	enum rstatus status = stream_end(s);
+	if(status) memset(&value, 0, sizeof(value));
+	else status = types[s->type].convert(&s->n, &value);
+	s->callback(s->index++, &value, (struct rresult){status, s->status ? s->error_at : 0}, s->context);
+	stream_reset(s);
 }
-long double _rlongdouble(char* readable_number) {
-	char* number;
-	char negative;
-	char floating;
-	extract_number(readable_number, &number, NULL, &negative, &floating);
 
-	if(!number) return 0.0;
-	if(!floating) {
-		fprintf(stderr, "[CREADABLE ERROR] Cannot assign integer number to floating point type. Defaulting to zero.\n");
-		return 0.0;
+CREADABLE_API enum rstatus rstream_init(rstream_t* stream, enum rtype type, char delimiter, rstream_callback callback, void* context) {
+	if(!delimiter_allowed(delimiter)) return RSTATUS_INVALID_ARGUMENT;
+	if(type >= RTYPE_SKIP || !callback) {
+		emit_error(RSTATUS_INVALID_ARGUMENT, "[CREADABLE ERROR] A stream needs a type and a callback.");
+		return RSTATUS_INVALID_ARGUMENT;
 	}
 
-	long double ret = strtold(number, NULL);
-	if(negative) ret = -ret;
+	struct stream_state* s = (struct stream_state*)stream->state.bytes;
+	s->type = type;
+	s->delimiter = delimiter;
+	s->callback = callback;
+	s->context = context;
+	s->index = 0;
+	stream_reset(s);
+	return RSTATUS_OK;
+}
+
+CREADABLE_API size_t rstream_feed(rstream_t* stream, const char* chunk, size_t length) {
+	struct stream_state* s = (struct stream_state*)stream->state.bytes;
+	size_t before = s->index;
+	const char* end = chunk + length;
 
-	free(number);
-	return ret;
+	for(const char* p = chunk; p != end; ++p) {
+		if(*p == s->delimiter) {
+			stream_emit(s);
+			continue;
+		}
+		if(s->carriage) {
+			// not in front of the delimiter after all
+			s->carriage = 0;
+			stream_byte(s, '\r');
+		}
+		if(*p == '\r' && s->delimiter == '\n') s->carriage = 1;
+		else stream_byte(s, *p);
+
+		// the whole run of digits at once, the commonest case
+		if(s->n.ndigits && !s->status && !s->bits && !s->exponent_symbol && !s->whitespace && !s->carriage) {
+			while(p + 1 != end && p[1] >= '0' && p[1] <= '9' && s->n.ndigits < CREADABLE_MAX_DIGITS) {
+				s->n.digits[s->n.ndigits++] = *++p;
+				if(s->point) --s->n.exponent;
+				++s->total_digits;
+				++s->offset;
+			}
+		}
+	}
+	return s->index - before;
+}
+
+CREADABLE_API size_t rstream_finish(rstream_t* stream) {
+	struct stream_state* s = (struct stream_state*)stream->state.bytes;
+	if(!s->offset && !s->carriage) return 0;
+	// the end of the stream ends the last line, '\r' included
+	s->carriage = 0;
+	stream_emit(s);
+	return 1;
 }
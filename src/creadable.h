@@ -1,45 +1,733 @@
 #ifndef CREADABLE
 #define CREADABLE
 
-#define rchar(x) _rchar(#x)
-#define rschar(x) _rschar(#x)
-#define ruchar(x) _ruchar(#x)
+// Defining CREADABLE_INLINE before including this header turns CReadable
+// into a header-only library: the parsers become static inline and the
+// r*() macros fold literal arguments into constants at compile time.
+#ifdef CREADABLE_INLINE
+#define CREADABLE_API static inline
+#else
+#define CREADABLE_API
+#endif
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Outcome of a parse. The r*() macros print these and default to zero,
+// the batch API and the r*_ex() functions hand them back instead.
+enum rstatus {
+	RSTATUS_OK,
+	RSTATUS_EMPTY,              // no digit at all
+	RSTATUS_INVALID_SYMBOL,     // character that cannot appear in a number
+	RSTATUS_SEPARATOR_MISMATCH, // e.g. 1_000,000
+	RSTATUS_MISPLACED_SYMBOL,   // '-', '+', '.' or 'e' where it cannot be
+	RSTATUS_MISSING_EXPONENT,   // 'e' without digits after it
+	RSTATUS_OVERFLOW,
+	RSTATUS_UNDERFLOW,
+	RSTATUS_NEGATIVE_UNSIGNED,
+	RSTATUS_FLOAT_TO_INTEGER,
+	RSTATUS_INTEGER_TO_FLOAT,
+	RSTATUS_IO_ERROR,           // rparse_file() cannot open, read or map the file
+	RSTATUS_INVALID_ARGUMENT,   // e.g. a delimiter that can be part of a number
+	RSTATUS_INEXACT             // digits past the scale of rdecimal_*() with RROUND_EXACT
+};
+
+#define RSTATUS_COUNT (RSTATUS_INEXACT + 1)
+
+// What the r*_ex() functions return: offset is the byte of the input the
+// error was found at, or 0 when the error concerns the whole number
+// (overflow, wrong type, ...).
+struct rresult {
+	enum rstatus status;
+	size_t offset;
+};
+
+// Parser configuration, for input that groups digits or marks decimals
+// differently: rparser_init() builds it once from the separators allowed
+// (NULL for the default "_, \t"), the decimal mark ('\0' for '.') and
+// rparser_flags, and the r*_ex_with() functions read numbers through it.
+// Letters, digits and signs cannot be separators or the decimal mark, and
+// the decimal mark cannot be a separator too: rparser_init() reports it and
+// returns RSTATUS_INVALID_ARGUMENT.
+struct rparser {
+	unsigned char classes[256]; // what every byte is in a number
+};
+
+enum rparser_flags {
+	RPARSER_PLUS_SIGN = 1 // accept a leading '+'
+};
+
+// Errors of the r*() macros and _r*() functions go through a handler that
+// prints them on stderr by default. message is a complete line without the
+// newline. At most max_per_second messages are passed on (0 for no limit,
+// CREADABLE_ERROR_RATE by default); the others are dropped before being
+// formatted and counted in the next message that gets through.
+// A NULL handler restores the default one.
+typedef void (*rerror_handler)(enum rstatus status, const char* message, void* context);
+
+#ifndef CREADABLE_ERROR_RATE
+#define CREADABLE_ERROR_RATE 100
+#endif
+
+// Defining CREADABLE_CACHE instead makes every r*() call site remember its
+// result, so a literal is parsed once per thread rather than on every call.
+// Only the macros are cached: calling _rint() and friends directly on a
+// buffer whose contents change is still safe.
+#if defined(CREADABLE_CACHE) && !defined(CREADABLE_INLINE)
+
+#define rchar(...) _rchar_cached(#__VA_ARGS__)
+#define rschar(...) _rschar_cached(#__VA_ARGS__)
+#define ruchar(...) _ruchar_cached(#__VA_ARGS__)
+
+#define rshort(...) _rshort_cached(#__VA_ARGS__)
+#define rushort(...) _rushort_cached(#__VA_ARGS__)
+
+#define rint(...) _rint_cached(#__VA_ARGS__)
+#define ruint(...) _ruint_cached(#__VA_ARGS__)
+
+#define rlong(...) _rlong_cached(#__VA_ARGS__)
+#define rlonglong(...) _rlonglong_cached(#__VA_ARGS__)
+#define rulong(...) _rulong_cached(#__VA_ARGS__)
+#define rulonglong(...) _rulonglong_cached(#__VA_ARGS__)
+
+#define rfloat(...) _rfloat_cached(#__VA_ARGS__)
+
+#define rdouble(...) _rdouble_cached(#__VA_ARGS__)
+#define rlongdouble(...) _rlongdouble_cached(#__VA_ARGS__)
+
+#define _RPARSE_FN(name) _r##name##_cached
+#define _RPARSE_CALL(literal) (literal)
+
+#elif !defined(CREADABLE_INLINE)
+
+#define rchar(...) _rchar(#__VA_ARGS__)
+#define rschar(...) _rschar(#__VA_ARGS__)
+#define ruchar(...) _ruchar(#__VA_ARGS__)
+
+#define rshort(...) _rshort(#__VA_ARGS__)
+#define rushort(...) _rushort(#__VA_ARGS__)
+
+#define rint(...) _rint(#__VA_ARGS__)
+#define ruint(...) _ruint(#__VA_ARGS__)
+
+#define rlong(...) _rlong(#__VA_ARGS__)
+#define rlonglong(...) _rlonglong(#__VA_ARGS__)
+#define rulong(...) _rulong(#__VA_ARGS__)
+#define rulonglong(...) _rulonglong(#__VA_ARGS__)
+
+#define rfloat(...) _rfloat(#__VA_ARGS__)
+
+#define rdouble(...) _rdouble(#__VA_ARGS__)
+#define rlongdouble(...) _rlongdouble(#__VA_ARGS__)
+
+#define _RPARSE_FN(name) _r##name
+#define _RPARSE_CALL(literal) (literal)
+
+#else
+
+#define rchar(...) _rfold_char(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+#define rschar(...) _rfold_schar(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+#define ruchar(...) _rfold_uchar(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+
+#define rshort(...) _rfold_short(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+#define rushort(...) _rfold_ushort(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+
+#define rint(...) _rfold_int(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+#define ruint(...) _rfold_uint(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+
+#define rlong(...) _rfold_long(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+#define rlonglong(...) _rfold_longlong(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+#define rulong(...) _rfold_ulong(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+#define rulonglong(...) _rfold_ulonglong(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+
+#define rfloat(...) _rfold_float(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+
+#define rdouble(...) _rfold_double(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+#define rlongdouble(...) _rfold_longdouble(#__VA_ARGS__, sizeof(#__VA_ARGS__) - 1)
+
+#define _RPARSE_FN(name) _rfold_##name
+#define _RPARSE_CALL(literal) (literal, sizeof(literal) - 1)
+
+#endif
+
+// 128-bit integers, where the compiler has them. These are neither cached
+// nor folded: the macros always call the runtime parser.
+#ifdef __SIZEOF_INT128__
+#define ri128(...) _ri128(#__VA_ARGS__)
+#define ru128(...) _ru128(#__VA_ARGS__)
+#endif
+
+// rparse(1_000_000, &var) parses the literal as the type of var, stores it
+// there and evaluates to it. The last argument is the destination, so comma
+// grouped literals work as long as they have at most eight groups.
+#define rparse(...) _RPARSE_PICK(__VA_ARGS__, _RPARSE8, _RPARSE7, _RPARSE6, _RPARSE5, _RPARSE4, _RPARSE3, _RPARSE2, _RPARSE1, )(__VA_ARGS__)
+#define _RPARSE_PICK(_1, _2, _3, _4, _5, _6, _7, _8, _9, N, ...) N
+
+#define _RPARSE1(a, var) _RPARSE(#a, var)
+#define _RPARSE2(a, b, var) _RPARSE(#a "," #b, var)
+#define _RPARSE3(a, b, c, var) _RPARSE(#a "," #b "," #c, var)
+#define _RPARSE4(a, b, c, d, var) _RPARSE(#a "," #b "," #c "," #d, var)
+#define _RPARSE5(a, b, c, d, e, var) _RPARSE(#a "," #b "," #c "," #d "," #e, var)
+#define _RPARSE6(a, b, c, d, e, f, var) _RPARSE(#a "," #b "," #c "," #d "," #e "," #f, var)
+#define _RPARSE7(a, b, c, d, e, f, g, var) _RPARSE(#a "," #b "," #c "," #d "," #e "," #f "," #g, var)
+#define _RPARSE8(a, b, c, d, e, f, g, h, var) _RPARSE(#a "," #b "," #c "," #d "," #e "," #f "," #g "," #h, var)
+
+#define _RPARSE(literal, var) (*(var) = _Generic(*(var), \
+	char: _RPARSE_FN(char), \
+	signed char: _RPARSE_FN(schar), \
+	unsigned char: _RPARSE_FN(uchar), \
+	short: _RPARSE_FN(short), \
+	unsigned short: _RPARSE_FN(ushort), \
+	int: _RPARSE_FN(int), \
+	unsigned int: _RPARSE_FN(uint), \
+	long: _RPARSE_FN(long), \
+	long long: _RPARSE_FN(longlong), \
+	unsigned long: _RPARSE_FN(ulong), \
+	unsigned long long: _RPARSE_FN(ulonglong), \
+	float: _RPARSE_FN(float), \
+	double: _RPARSE_FN(double), \
+	long double: _RPARSE_FN(longdouble) \
+	)_RPARSE_CALL(literal))
+
+CREADABLE_API char _rchar(char* number);
+CREADABLE_API signed char _rschar(char* number);
+CREADABLE_API unsigned char _ruchar(char* number);
+
+CREADABLE_API short _rshort(char* number);
+CREADABLE_API unsigned short _rushort(char* number);
+
+CREADABLE_API int _rint(char* number);
+CREADABLE_API unsigned int _ruint(char* number);
+
+CREADABLE_API long _rlong(char* number);
+CREADABLE_API long long _rlonglong(char* number);
+CREADABLE_API unsigned long _rulong(char* number);
+CREADABLE_API unsigned long long _rulonglong(char* number);
+
+CREADABLE_API float _rfloat(char* number);
+
+CREADABLE_API double _rdouble(char* number);
+CREADABLE_API long double _rlongdouble(char* number);
+
+#ifdef __SIZEOF_INT128__
+CREADABLE_API __int128 _ri128(char* number);
+CREADABLE_API unsigned __int128 _ru128(char* number);
+#endif
+
+// Length-delimited prefix parsing: reads the number at the start of the
+// length bytes at number, which need not be NUL-terminated, and stops at the
+// first character that cannot continue it (a separator, '.' or 'e' only
+// continues it when a digit follows). *end is set to where parsing stopped,
+// or to number if there was no number; end may be NULL. Errors are
+// reported like those of the other _r*() functions.
+CREADABLE_API char _rchar_n(const char* number, size_t length, const char** end);
+CREADABLE_API signed char _rschar_n(const char* number, size_t length, const char** end);
+CREADABLE_API unsigned char _ruchar_n(const char* number, size_t length, const char** end);
+
+CREADABLE_API short _rshort_n(const char* number, size_t length, const char** end);
+CREADABLE_API unsigned short _rushort_n(const char* number, size_t length, const char** end);
+
+CREADABLE_API int _rint_n(const char* number, size_t length, const char** end);
+CREADABLE_API unsigned int _ruint_n(const char* number, size_t length, const char** end);
+
+CREADABLE_API long _rlong_n(const char* number, size_t length, const char** end);
+CREADABLE_API long long _rlonglong_n(const char* number, size_t length, const char** end);
+CREADABLE_API unsigned long _rulong_n(const char* number, size_t length, const char** end);
+CREADABLE_API unsigned long long _rulonglong_n(const char* number, size_t length, const char** end);
+
+CREADABLE_API float _rfloat_n(const char* number, size_t length, const char** end);
+
+CREADABLE_API double _rdouble_n(const char* number, size_t length, const char** end);
+CREADABLE_API long double _rlongdouble_n(const char* number, size_t length, const char** end);
+
+#ifdef __SIZEOF_INT128__
+CREADABLE_API __int128 _ri128_n(const char* number, size_t length, const char** end);
+CREADABLE_API unsigned __int128 _ru128_n(const char* number, size_t length, const char** end);
+#endif
+
+CREADABLE_API struct rresult rchar_ex(const char* number, char* out);
+CREADABLE_API struct rresult rschar_ex(const char* number, signed char* out);
+CREADABLE_API struct rresult ruchar_ex(const char* number, unsigned char* out);
+
+CREADABLE_API struct rresult rshort_ex(const char* number, short* out);
+CREADABLE_API struct rresult rushort_ex(const char* number, unsigned short* out);
+
+CREADABLE_API struct rresult rint_ex(const char* number, int* out);
+CREADABLE_API struct rresult ruint_ex(const char* number, unsigned int* out);
+
+CREADABLE_API struct rresult rlong_ex(const char* number, long* out);
+CREADABLE_API struct rresult rlonglong_ex(const char* number, long long* out);
+CREADABLE_API struct rresult rulong_ex(const char* number, unsigned long* out);
+CREADABLE_API struct rresult rulonglong_ex(const char* number, unsigned long long* out);
+
+CREADABLE_API struct rresult rfloat_ex(const char* number, float* out);
+
+CREADABLE_API struct rresult rdouble_ex(const char* number, double* out);
+CREADABLE_API struct rresult rlongdouble_ex(const char* number, long double* out);
+
+#ifdef __SIZEOF_INT128__
+CREADABLE_API struct rresult ri128_ex(const char* number, __int128* out);
+CREADABLE_API struct rresult ru128_ex(const char* number, unsigned __int128* out);
+#endif
+
+CREADABLE_API enum rstatus rparser_init(struct rparser* parser, const char* separators, char decimal_mark, unsigned flags);
+
+CREADABLE_API struct rresult rchar_ex_with(const char* number, char* out, const struct rparser* parser);
+CREADABLE_API struct rresult rschar_ex_with(const char* number, signed char* out, const struct rparser* parser);
+CREADABLE_API struct rresult ruchar_ex_with(const char* number, unsigned char* out, const struct rparser* parser);
+
+CREADABLE_API struct rresult rshort_ex_with(const char* number, short* out, const struct rparser* parser);
+CREADABLE_API struct rresult rushort_ex_with(const char* number, unsigned short* out, const struct rparser* parser);
+
+CREADABLE_API struct rresult rint_ex_with(const char* number, int* out, const struct rparser* parser);
+CREADABLE_API struct rresult ruint_ex_with(const char* number, unsigned int* out, const struct rparser* parser);
+
+CREADABLE_API struct rresult rlong_ex_with(const char* number, long* out, const struct rparser* parser);
+CREADABLE_API struct rresult rlonglong_ex_with(const char* number, long long* out, const struct rparser* parser);
+CREADABLE_API struct rresult rulong_ex_with(const char* number, unsigned long* out, const struct rparser* parser);
+CREADABLE_API struct rresult rulonglong_ex_with(const char* number, unsigned long long* out, const struct rparser* parser);
+
+CREADABLE_API struct rresult rfloat_ex_with(const char* number, float* out, const struct rparser* parser);
+
+CREADABLE_API struct rresult rdouble_ex_with(const char* number, double* out, const struct rparser* parser);
+CREADABLE_API struct rresult rlongdouble_ex_with(const char* number, long double* out, const struct rparser* parser);
+
+#ifdef __SIZEOF_INT128__
+CREADABLE_API struct rresult ri128_ex_with(const char* number, __int128* out, const struct rparser* parser);
+CREADABLE_API struct rresult ru128_ex_with(const char* number, unsigned __int128* out, const struct rparser* parser);
+#endif
+
+// Fixed point: the number times 10^scale, as an integer, e.g. 12345 for
+// "1,234.5" at scale 1. It follows the rules of the other parsers, so an
+// integer or an exponent is fine too, and is never converted to floating
+// point. The digits past the scale are rounded the chosen way, or rejected
+// with RSTATUS_INEXACT if any of them is not zero. Values out of range are
+// RSTATUS_OVERFLOW or RSTATUS_UNDERFLOW, and a rounding that is none of the
+// below is RSTATUS_INVALID_ARGUMENT.
+enum rrounding {
+	RROUND_EXACT,
+	RROUND_HALF_EVEN,   // to nearest, ties to even (banker's rounding)
+	RROUND_HALF_AWAY,   // to nearest, ties away from zero
+	RROUND_TOWARD_ZERO, // truncation
+	RROUND_FLOOR,
+	RROUND_CEILING
+};
+
+CREADABLE_API struct rresult rdecimal_i64(const char* number, unsigned scale, enum rrounding rounding, int64_t* out);
+
+#ifdef __SIZEOF_INT128__
+CREADABLE_API struct rresult rdecimal_i128(const char* number, unsigned scale, enum rrounding rounding, __int128* out);
+#endif
+
+// Integers of any length, e.g. "0xFFFF_FFFF_FFFF_FFFF_FFFF_FFFF_FFFF_FFFF"
+// or a few thousand grouped decimal digits, from the length bytes at number
+// (a NUL among them is an invalid symbol). The magnitude goes to 64-bit limbs in memory
+// the caller owns; nothing is allocated. rbig_ex() puts them at the start
+// of workspace, which holds size limbs and is also used as scratch space:
+// rbig_workspace(length) limbs are always enough. rbig_arena_ex() takes
+// the workspace from what is left of the arena and only keeps the limbs
+// of the result there; setting used back to 0 frees every number at once.
+// RSTATUS_OVERFLOW means the space was too small, RSTATUS_FLOAT_TO_INTEGER
+// that the number has a decimal point or an exponent. Long decimal numbers
+// take subquadratic time.
+struct rbig {
+	uint64_t* limbs;  // least significant first
+	size_t count;     // limbs in use, 0 for zero; limbs[count - 1] is never 0
+	char negative;
+};
+
+struct rarena {
+	void* memory;
+	size_t size;  // bytes
+	size_t used;  // bytes handed out, from the start of memory
+};
+
+CREADABLE_API size_t rbig_workspace(size_t length);
+CREADABLE_API struct rresult rbig_ex(const char* number, size_t length, uint64_t* workspace, size_t size, struct rbig* out);
+CREADABLE_API struct rresult rbig_arena_ex(const char* number, size_t length, struct rarena* arena, struct rbig* out);
+
+// Validation only: whether the length bytes at number (a NUL among them is
+// an invalid symbol) make a well formed number, i.e. what the r*_ex() functions would
+// report before looking at its value or its type. Nothing is converted or
+// allocated; offset is that of the first offending byte, as for r*_ex().
+// On x86 it checks 16, 32 or 64 bytes at a time however long the number is,
+// see rsimd_level().
+CREADABLE_API struct rresult rvalidate(const char* number, size_t length);
+
+// The same for count NUL-terminated numbers: bit (i % 8) of invalid[i / 8]
+// is set when numbers[i] is not well formed (invalid may be NULL). Returns
+// how many are not.
+CREADABLE_API size_t rvalidate_batch(const char* const* numbers, size_t count, unsigned char* invalid);
+
+// The instruction set the parsers' inner loops use: "scalar", "sse2",
+// "avx2" or "avx512". The best one the CPU supports is chosen when the
+// library is loaded; setting CREADABLE_SIMD to one of these names in the
+// environment caps the choice at that level.
+CREADABLE_API const char* rsimd_level(void);
+
+// Formatting: writes value in decimal into buffer, with separator ('_',
+// ',' or ' ') between groups of three digits, or no grouping if it is '\0'.
+// Returns the length of the text, terminating NUL excluded. If that does
+// not fit in size bytes nothing is written but an empty string.
+// The _r*() parser of the same type reads the text back to value.
+// Any other separator is reported as RSTATUS_INVALID_ARGUMENT to the error
+// handler, and the result is an empty string and 0 (no value is written
+// as an empty text).
+CREADABLE_API size_t rformat_char(char value, char separator, char* buffer, size_t size);
+CREADABLE_API size_t rformat_schar(signed char value, char separator, char* buffer, size_t size);
+CREADABLE_API size_t rformat_uchar(unsigned char value, char separator, char* buffer, size_t size);
+
+CREADABLE_API size_t rformat_short(short value, char separator, char* buffer, size_t size);
+CREADABLE_API size_t rformat_ushort(unsigned short value, char separator, char* buffer, size_t size);
+
+CREADABLE_API size_t rformat_int(int value, char separator, char* buffer, size_t size);
+CREADABLE_API size_t rformat_uint(unsigned int value, char separator, char* buffer, size_t size);
+
+CREADABLE_API size_t rformat_long(long value, char separator, char* buffer, size_t size);
+CREADABLE_API size_t rformat_longlong(long long value, char separator, char* buffer, size_t size);
+CREADABLE_API size_t rformat_ulong(unsigned long value, char separator, char* buffer, size_t size);
+CREADABLE_API size_t rformat_ulonglong(unsigned long long value, char separator, char* buffer, size_t size);
+
+// The fewest significant digits that _rfloat()/_rdouble() read back to
+// value, always with a decimal point: "1_234_567.125", "0.1", "100.0". From
+// 1e21 up and below 1e-6 the exponent is written instead ("1.0e21",
+// "1.5e-7"); only the integer part is grouped. Infinities and NaN come out
+// as "inf", "-inf" and "nan", which the parsers do not read.
+CREADABLE_API size_t rformat_float(float value, char separator, char* buffer, size_t size);
+CREADABLE_API size_t rformat_double(double value, char separator, char* buffer, size_t size);
+
+CREADABLE_API void rset_error_handler(rerror_handler handler, void* context, unsigned max_per_second);
+
+CREADABLE_API char _rchar_cached(char* number);
+CREADABLE_API signed char _rschar_cached(char* number);
+CREADABLE_API unsigned char _ruchar_cached(char* number);
+
+CREADABLE_API short _rshort_cached(char* number);
+CREADABLE_API unsigned short _rushort_cached(char* number);
+
+CREADABLE_API int _rint_cached(char* number);
+CREADABLE_API unsigned int _ruint_cached(char* number);
+
+CREADABLE_API long _rlong_cached(char* number);
+CREADABLE_API long long _rlonglong_cached(char* number);
+CREADABLE_API unsigned long _rulong_cached(char* number);
+CREADABLE_API unsigned long long _rulonglong_cached(char* number);
+
+CREADABLE_API float _rfloat_cached(char* number);
+
+CREADABLE_API double _rdouble_cached(char* number);
+CREADABLE_API long double _rlongdouble_cached(char* number);
+
+// Every type a number can be parsed into.
+enum rtype {
+	RTYPE_CHAR,
+	RTYPE_SCHAR,
+	RTYPE_UCHAR,
+	RTYPE_SHORT,
+	RTYPE_USHORT,
+	RTYPE_INT,
+	RTYPE_UINT,
+	RTYPE_LONG,
+	RTYPE_LONGLONG,
+	RTYPE_ULONG,
+	RTYPE_ULONGLONG,
+	RTYPE_FLOAT,
+	RTYPE_DOUBLE,
+	RTYPE_LONGDOUBLE,
+	RTYPE_SKIP // file columns only: the field is not parsed
+};
 
-#define rshort(x) _rshort(#x)
-#define rushort(x) _rushort(#x)
+#define RTYPE_COUNT RTYPE_SKIP
 
-#define rint(x) _rint(#x)
-#define ruint(x) _ruint(#x)
+// Runtime statistics, collected when the library is built with
+// CREADABLE_STATS (and CREADABLE_STATS_CYCLES for the timings). Every call
+// of a typed parser counts, whichever API it came through. statuses[s] is
+// the number of calls that ended with status s, and cycles[b] the number of
+// calls that took less than 2^(b+1) cycles (the last bucket takes the rest).
+// Without CREADABLE_STATS the snapshot is all zeros.
+#define RSTATS_BUCKETS 32
 
-#define rlong(x) _rlong(#x)
-#define rlonglong(x) _rlonglong(#x)
-#define rulong(x) _rulong(#x)
-#define rulonglong(x) _rulonglong(#x)
+struct rstats_type {
+	unsigned long long calls;
+	unsigned long long bytes;
+	unsigned long long statuses[RSTATUS_COUNT];
+	unsigned long long cycles[RSTATS_BUCKETS];
+};
 
-#define rfloat(x) _rfloat(#x)
+struct rstats {
+	struct rstats_type types[RTYPE_COUNT]; // indexed by enum rtype
+};
 
-#define rdouble(x) _rdouble(#x)
-#define rlongdouble(x) _rlongdouble(#x)
+enum rstats_format {
+	RSTATS_TEXT,
+	RSTATS_JSON
+};
 
-char _rchar(char* number);
-signed char _rschar(char* number);
-unsigned char _ruchar(char* number);
+// rstats_snapshot() sums the counters of every thread since the last
+// rstats_reset(); rstats_dump() prints the types that were used.
+CREADABLE_API void rstats_snapshot(struct rstats* stats);
+CREADABLE_API void rstats_reset(void);
+CREADABLE_API void rstats_dump(FILE* out, const struct rstats* stats, enum rstats_format format);
 
-short _rshort(char* number);
-unsigned short _rushort(char* number);
+// Batch parsing: numbers[i] is parsed into out[i] and, if status is not
+// NULL, its outcome is stored in status[i] instead of being printed. The
+// work is split across `threads` threads (0 or 1 parses on the calling
+// thread). Returns how many numbers failed to parse.
+CREADABLE_API size_t rparse_batch_char(const char* const* numbers, size_t count, char* out, uint8_t* status, unsigned threads);
+CREADABLE_API size_t rparse_batch_schar(const char* const* numbers, size_t count, signed char* out, uint8_t* status, unsigned threads);
+CREADABLE_API size_t rparse_batch_uchar(const char* const* numbers, size_t count, unsigned char* out, uint8_t* status, unsigned threads);
 
-int _rint(char* number);
-unsigned int _ruint(char* number);
+CREADABLE_API size_t rparse_batch_short(const char* const* numbers, size_t count, short* out, uint8_t* status, unsigned threads);
+CREADABLE_API size_t rparse_batch_ushort(const char* const* numbers, size_t count, unsigned short* out, uint8_t* status, unsigned threads);
 
-long _rlong(char* number);
-long long _rlonglong(char* number);
-unsigned long _rulong(char* number);
-unsigned long long _rulonglong(char* number);
+CREADABLE_API size_t rparse_batch_int(const char* const* numbers, size_t count, int* out, uint8_t* status, unsigned threads);
+CREADABLE_API size_t rparse_batch_uint(const char* const* numbers, size_t count, unsigned int* out, uint8_t* status, unsigned threads);
 
-float _rfloat(char* number);
+CREADABLE_API size_t rparse_batch_long(const char* const* numbers, size_t count, long* out, uint8_t* status, unsigned threads);
+CREADABLE_API size_t rparse_batch_longlong(const char* const* numbers, size_t count, long long* out, uint8_t* status, unsigned threads);
+CREADABLE_API size_t rparse_batch_ulong(const char* const* numbers, size_t count, unsigned long* out, uint8_t* status, unsigned threads);
+CREADABLE_API size_t rparse_batch_ulonglong(const char* const* numbers, size_t count, unsigned long long* out, uint8_t* status, unsigned threads);
 
-double _rdouble(char* number);
-long double _rlongdouble(char* number);
+CREADABLE_API size_t rparse_batch_float(const char* const* numbers, size_t count, float* out, uint8_t* status, unsigned threads);
 
+CREADABLE_API size_t rparse_batch_double(const char* const* numbers, size_t count, double* out, uint8_t* status, unsigned threads);
+CREADABLE_API size_t rparse_batch_longdouble(const char* const* numbers, size_t count, long double* out, uint8_t* status, unsigned threads);
+
+// File ingestion: every line of the file is a record and its fields,
+// separated by `delimiter`, go to the matching column. values points to
+// max_rows elements of the column's type. Records past max_rows are counted
+// but not parsed. Bit (row % 8) of row_errors[row / 8] is set when a field
+// of that row fails to parse or the row does not have ncolumns fields (the
+// missing ones are zeroed); row_errors may be NULL.
+// Returns the number of records in the file, or -1 if it cannot be read or
+// the delimiter is '\n' or one rindex_fields() rejects.
+struct rcolumn {
+	enum rtype type;
+	void* values;
+};
+
+CREADABLE_API long long rparse_file(const char* path, char delimiter, const struct rcolumn* columns, size_t ncolumns, size_t max_rows, unsigned char* row_errors, unsigned threads);
+
+// Delimited buffers: the numbers of a buffer separated by `delimiter`, such
+// as "1_000;2_500_000;-3;4.25" with ';', parsed in two passes.
+// rindex_fields() finds the delimiters 64 bytes at a time and writes the
+// offset where each field ends (the delimiter's, or length for the last
+// field) to ends[], at most max_fields of them; field i starts right after
+// field i - 1 ends. rparse_fields() then parses the count fields of that
+// index, built with `delimiter`, into out[] as `type`, the outcome of field i going to status[i] if
+// status is not NULL, and returns how many failed. rparse_delimited() does
+// both a block at a time. A delimiter ending the buffer does not start an
+// empty field. With '\n' as delimiter a '\r' ending a field is ignored, as
+// by rparse_file() and rstream_feed(); with any other it is invalid.
+// The delimiter cannot be a byte a number may contain, separators
+// included: digits, '.', '-', '+', 'e', 'E', '_', ',', ' ' and '\t' are
+// rejected with RSTATUS_INVALID_ARGUMENT and -1, while '\0' is fine. Both
+// otherwise return how many fields the buffer has; fields past max_fields
+// are counted but not indexed or parsed.
+CREADABLE_API long long rindex_fields(const char* buffer, size_t length, char delimiter, size_t* ends, size_t max_fields);
+CREADABLE_API size_t rparse_fields(const char* buffer, const size_t* ends, size_t count, char delimiter, enum rtype type, void* out, uint8_t* status);
+CREADABLE_API long long rparse_delimited(const char* buffer, size_t length, char delimiter, enum rtype type, void* out, size_t max_fields, uint8_t* status);
+
+// Streaming: numbers separated by `delimiter` arrive in chunks cut
+// anywhere, even inside a number, and are parsed as they come. Only the
+// state of the number in progress is kept between rstream_feed() calls,
+// never the text. Every number is handed to the callback as soon as its
+// delimiter arrives (the last one by rstream_finish()): value points to it
+// as the stream's type, zero if result.status is not RSTATUS_OK, and
+// result.offset counts from the start of that number. index is its
+// position in the stream. With '\n' as delimiter a '\r' before it, or
+// ending the stream, is ignored. rstream_init() rejects the delimiters rindex_fields() does, with
+// RSTATUS_INVALID_ARGUMENT.
+typedef void (*rstream_callback)(size_t index, const void* value, struct rresult result, void* context);
+
+typedef struct rstream {
+	union {
+		unsigned char bytes[1024];
+		long double align;
+		void* pointer;
+	} state; // only for the rstream_*() functions
+} rstream_t;
+
+CREADABLE_API enum rstatus rstream_init(rstream_t* stream, enum rtype type, char delimiter, rstream_callback callback, void* context);
+
+// Both return how many numbers they completed. rstream_finish() completes
+// the last number, if any byte of it was fed, and readies the stream for a
+// new input.
+CREADABLE_API size_t rstream_feed(rstream_t* stream, const char* chunk, size_t length);
+CREADABLE_API size_t rstream_finish(rstream_t* stream);
+
+#ifdef __cplusplus
+}
 #endif
 
+#ifdef CREADABLE_INLINE
+
+#include <limits.h>
+
+#if defined(__GNUC__)
+#define _RFOLD_INLINE static inline __attribute__((always_inline))
+#else
+#define _RFOLD_INLINE static inline
+#endif
+
+// Literals longer than this are left to the runtime parser.
+#define _RFOLD_MAX_LEN 48
+
+// A straight-line re-implementation of the extract_number rules. Every
+// step only depends on a character of the literal, so once inlined the
+// optimiser evaluates the whole thing. It is conservative: anything it is
+// not sure about (errors, overflow, inexact floats) is handed to the
+// runtime parser, which then reports it as usual.
+struct _rfold {
+	unsigned long long mantissa;
+	int exponent; // mantissa has to be scaled by 10^exponent (never positive)
+	char ok;
+	char started;
+	char negative;
+	char floating;
+	char separator;
+	char any_digit;
+	char trailing_space;
+};
+
+_RFOLD_INLINE struct _rfold _rfold_step(struct _rfold f, char c) {
+	if(!f.ok) return f;
+	f.trailing_space = 0;
+
+	switch(c) {
+	case '0':
+	case '1':
+	case '2':
+	case '3':
+	case '4':
+	case '5':
+	case '6':
+	case '7':
+	case '8':
+	case '9': {
+		unsigned digit = (unsigned)(c - '0');
+		f.started = 1;
+		f.any_digit = 1;
+		if(f.mantissa > (ULLONG_MAX - digit)/10) {
+			f.ok = 0;
+			break;
+		}
+		f.mantissa = f.mantissa*10 + digit;
+		if(f.floating) --f.exponent;
+	}
+	break;
+	case '-':
+		if(f.started) f.ok = 0;
+		f.started = 1;
+		f.negative = 1;
+	break;
+	case ' ':
+	case '\t':
+		f.trailing_space = 1;
+		if(!f.separator) f.separator = c;
+		else if(f.separator != c) f.ok = 0;
+	break;
+	case '_':
+	case ',':
+		f.started = 1;
+		if(!f.separator) f.separator = c;
+		else if(f.separator != c) f.ok = 0;
+	break;
+	case '.':
+		if(!f.started || f.floating) f.ok = 0;
+		f.floating = 1;
+	break;
+	default:
+		f.ok = 0;
+	break;
+	}
+	return f;
+}
+
+#define _RFOLD_STEP(i) if((i) < len) f = _rfold_step(f, s[i])
+#define _RFOLD_STEP4(i) _RFOLD_STEP(i); _RFOLD_STEP(i+1); _RFOLD_STEP(i+2); _RFOLD_STEP(i+3)
+#define _RFOLD_STEP16(i) _RFOLD_STEP4(i); _RFOLD_STEP4(i+4); _RFOLD_STEP4(i+8); _RFOLD_STEP4(i+12)
+
+_RFOLD_INLINE struct _rfold _rfold_scan(const char* s, size_t len) {
+	struct _rfold f = {0, 0, 1, 0, 0, 0, '\0', 0, 0};
+	if(len > _RFOLD_MAX_LEN) {
+		f.ok = 0;
+		return f;
+	}
+	_RFOLD_STEP16(0);
+	_RFOLD_STEP16(16);
+	_RFOLD_STEP16(32);
+
+	// trailing whitespace is ignored by the runtime parser, leave it to it
+	f.ok = f.ok && f.any_digit && !f.trailing_space;
+	return f;
+}
+
+#define _RFOLD_SIGNED(name, type, min, max) \
+	_RFOLD_INLINE type _rfold_##name(char* s, size_t len) { \
+		struct _rfold f = _rfold_scan(s, len); \
+		if(f.ok && !f.floating) { \
+			if(f.negative && f.mantissa <= (unsigned long long)-((min)+1) + 1) \
+				return f.mantissa ? (type)(-(type)(f.mantissa - 1) - 1) : 0; \
+			if(!f.negative && f.mantissa <= (unsigned long long)(max)) \
+				return (type)f.mantissa; \
+		} \
+		return _r##name(s); \
+	}
+
+#define _RFOLD_UNSIGNED(name, type, max) \
+	_RFOLD_INLINE type _rfold_##name(char* s, size_t len) { \
+		struct _rfold f = _rfold_scan(s, len); \
+		if(f.ok && !f.floating && !f.negative && f.mantissa <= (unsigned long long)(max)) \
+			return (type)f.mantissa; \
+		return _r##name(s); \
+	}
+
+// Only the exact cases are folded: a mantissa and a power of ten that are
+// both representable, so a single division is correctly rounded just like
+// the strto* result.
+#define _RFOLD_FLOATING(name, type, max_mantissa, max_exponent) \
+	_RFOLD_INLINE type _rfold_##name(char* s, size_t len) { \
+		struct _rfold f = _rfold_scan(s, len); \
+		if(f.ok && f.floating && f.mantissa <= (max_mantissa) && f.exponent >= -(max_exponent)) { \
+			type ret = (type)f.mantissa / (type)_rfold_pow10[-f.exponent]; \
+			return f.negative ? -ret : ret; \
+		} \
+		return _r##name(s); \
+	}
+
+static const double _rfold_pow10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+	1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+_RFOLD_SIGNED(char, char, CHAR_MIN, CHAR_MAX)
+_RFOLD_SIGNED(schar, signed char, SCHAR_MIN, SCHAR_MAX)
+_RFOLD_UNSIGNED(uchar, unsigned char, UCHAR_MAX)
+
+_RFOLD_SIGNED(short, short, SHRT_MIN, SHRT_MAX)
+_RFOLD_UNSIGNED(ushort, unsigned short, USHRT_MAX)
+
+_RFOLD_SIGNED(int, int, INT_MIN, INT_MAX)
+_RFOLD_UNSIGNED(uint, unsigned int, UINT_MAX)
+
+_RFOLD_SIGNED(long, long, LONG_MIN, LONG_MAX)
+_RFOLD_SIGNED(longlong, long long, LLONG_MIN, LLONG_MAX)
+_RFOLD_UNSIGNED(ulong, unsigned long, ULONG_MAX)
+_RFOLD_UNSIGNED(ulonglong, unsigned long long, ULLONG_MAX)
+
+_RFOLD_FLOATING(float, float, 1ULL << 24, 10)
+
+_RFOLD_FLOATING(double, double, 1ULL << 53, 22)
+_RFOLD_FLOATING(longdouble, long double, 1ULL << 53, 22)
+
+#include "creadable.c"
+
+#endif
+
+#endif
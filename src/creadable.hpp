@@ -0,0 +1,805 @@
+#ifndef CREADABLE_HPP
+#define CREADABLE_HPP
+
+// C++20 companion of creadable.h: the same number syntax, read by constexpr
+// code so that literals are checked and folded by the compiler.
+//  - creadable::parse<int>("1_000_000") is consteval: it is a constant, and
+//    a literal that does not parse is a compile error naming the problem
+//    (a call to creadable::detail::literal_overflows() and so on);
+//  - "1_000_000"_rint and the other literals of creadable::literals do the
+//    same;
+//  - creadable::from_chars() and creadable::parse(text, value) run at
+//    compile time or at run time and return a creadable::result instead.
+// Only the default syntax is understood ('_', ',', space and tab as
+// separators, '.' as decimal mark, no leading '+'): struct rparser
+// configurations are for the C functions.
+// The r*() macros of creadable.h are still defined, so standard headers
+// declaring rint() (<cmath>, <math.h>) have to be included before this one.
+
+#include <cfloat>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <string_view>
+#include <type_traits>
+
+#include "creadable.h"
+
+namespace creadable {
+
+// What from_chars() and the two-argument parse() return, in the manner of
+// std::from_chars_result. For from_chars() ptr is where the number ended,
+// for parse() it is the end of the text on success, the offending byte or,
+// when the error concerns the whole number (overflow, wrong type, ...), the
+// start of the text, like the offset of struct rresult.
+struct result {
+	const char* ptr;
+	enum rstatus ec;
+
+	constexpr explicit operator bool() const noexcept { return ec == RSTATUS_OK; }
+	friend constexpr bool operator==(const result&, const result&) = default;
+};
+
+namespace detail {
+
+// Every type creadable.h parses into, with the unsigned type its magnitude
+// is accumulated in.
+template<class T> struct unsigned_of {};
+template<> struct unsigned_of<char> { using type = unsigned char; };
+template<> struct unsigned_of<signed char> { using type = unsigned char; };
+template<> struct unsigned_of<unsigned char> { using type = unsigned char; };
+template<> struct unsigned_of<short> { using type = unsigned short; };
+template<> struct unsigned_of<unsigned short> { using type = unsigned short; };
+template<> struct unsigned_of<int> { using type = unsigned int; };
+template<> struct unsigned_of<unsigned int> { using type = unsigned int; };
+template<> struct unsigned_of<long> { using type = unsigned long; };
+template<> struct unsigned_of<long long> { using type = unsigned long long; };
+template<> struct unsigned_of<unsigned long> { using type = unsigned long; };
+template<> struct unsigned_of<unsigned long long> { using type = unsigned long long; };
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 int128;
+__extension__ typedef unsigned __int128 uint128;
+template<> struct unsigned_of<int128> { using type = uint128; };
+template<> struct unsigned_of<uint128> { using type = uint128; };
+#endif
+
+template<class T> concept integer = requires { typename unsigned_of<T>::type; };
+template<class T> concept floating = std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, long double>;
+template<class T> concept parsable = integer<T> || floating<T>;
+
+// Significant digits kept, like CREADABLE_MAX_DIGITS in creadable.c: past
+// them only whether a non-zero digit was dropped matters. The decimal
+// shifts below work in the same buffer.
+inline constexpr int max_digits = 800;
+
+struct number {
+	unsigned char digits[max_digits]; // digit values, leading zeros dropped
+	int ndigits = 0;
+	int exponent = 0; // digits[] has to be scaled by 10^exponent
+	bool truncated = false; // a non-zero digit did not fit in digits[]
+	bool negative = false;
+	bool floating = false;
+	unsigned base = 10;
+
+	// what went wrong
+	const char* error_at = nullptr;
+	char separator = '\0';
+};
+
+// The classes of creadable.c, for the default parser.
+enum char_class {
+	CLASS_OTHER,
+	CLASS_END,
+	CLASS_DIGIT,
+	CLASS_SEPARATOR,
+	CLASS_SPACE,
+	CLASS_POINT,
+	CLASS_EXPONENT,
+	CLASS_MINUS,
+	CLASS_EXPONENT_PLUS
+};
+
+constexpr char_class classify(char c) {
+	switch(c) {
+	case '\0':
+		return CLASS_END;
+	case '0': case '1': case '2': case '3': case '4':
+	case '5': case '6': case '7': case '8': case '9':
+		return CLASS_DIGIT;
+	case '_':
+	case ',':
+		return CLASS_SEPARATOR;
+	case ' ':
+	case '\t':
+		return CLASS_SPACE;
+	case '.':
+		return CLASS_POINT;
+	case 'e':
+	case 'E':
+		return CLASS_EXPONENT;
+	case '-':
+		return CLASS_MINUS;
+	case '+':
+		return CLASS_EXPONENT_PLUS;
+	default:
+		return CLASS_OTHER;
+	}
+}
+
+// The value of a digit in bases up to 16, 0xFF for anything else.
+constexpr unsigned digit_value(char c) {
+	if(c >= '0' && c <= '9') return unsigned(c - '0');
+	if(c >= 'a' && c <= 'f') return unsigned(c - 'a' + 10);
+	if(c >= 'A' && c <= 'F') return unsigned(c - 'A' + 10);
+	return 0xFF;
+}
+
+constexpr unsigned radix_bits(char letter) {
+	switch(letter) {
+	case 'x':
+	case 'X':
+		return 4;
+	case 'o':
+	case 'O':
+		return 3;
+	case 'b':
+	case 'B':
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+constexpr bool digit_at(const char* p, const char* last) {
+	return p != last && *p >= '0' && *p <= '9';
+}
+
+constexpr enum rstatus use_separator(const char* p, number& n) {
+	if(n.separator == '\0') {
+		n.separator = *p;
+	}
+	else if(n.separator != *p) {
+		n.error_at = p;
+		return RSTATUS_SEPARATOR_MISMATCH;
+	}
+	return RSTATUS_OK;
+}
+
+// A run of whitespace followed by more of the number is made of separators.
+constexpr enum rstatus use_whitespace(const char* whitespace, const char* p, number& n) {
+	for(const char* w = whitespace; w < p; ++w) {
+		enum rstatus status = use_separator(w, n);
+		if(status) return status;
+	}
+	return RSTATUS_OK;
+}
+
+// extract_radix() of creadable.c: the digits of 0x, 0o and 0b integers,
+// from just past the base letter at `prefix` on.
+constexpr enum rstatus scan_radix(const char* prefix, const char* last, const char** stop, number& n, unsigned bits) {
+	unsigned base = 1u << bits;
+	std::size_t total_digits = 0;
+	const char* whitespace = nullptr;
+	n.base = base;
+
+	const char* p = prefix + 1;
+	for(; p != last; ++p) {
+		char_class c = classify(*p);
+		if(c == CLASS_SPACE) {
+			if(!whitespace) whitespace = p;
+			continue;
+		}
+		if(c == CLASS_END) break;
+		if(whitespace) {
+			if(stop && digit_value(*p) >= base) break;
+			enum rstatus status = use_whitespace(whitespace, p, n);
+			if(status) {
+				if(stop) break;
+				return status;
+			}
+			whitespace = nullptr;
+		}
+
+		enum rstatus status = RSTATUS_OK;
+		unsigned digit = digit_value(*p);
+		if(digit < base) {
+			++total_digits;
+			if(n.ndigits == max_digits) n.truncated = true;
+			else if(n.ndigits || digit) n.digits[n.ndigits++] = (unsigned char)digit;
+		}
+		else if(c == CLASS_SEPARATOR) {
+			if(stop && (p + 1 == last || digit_value(p[1]) >= base)) break;
+			status = use_separator(p, n);
+		}
+		else if(c == CLASS_MINUS || c == CLASS_EXPONENT_PLUS || c == CLASS_POINT) {
+			status = RSTATUS_MISPLACED_SYMBOL;
+		}
+		else {
+			status = RSTATUS_INVALID_SYMBOL;
+		}
+
+		if(status) {
+			if(stop) break;
+			n.error_at = p;
+			return status;
+		}
+	}
+
+	if(stop) *stop = whitespace ? whitespace : p;
+	if(!total_digits) {
+		n.error_at = prefix;
+		return RSTATUS_MISPLACED_SYMBOL;
+	}
+	return RSTATUS_OK;
+}
+
+// extract_number() of creadable.c, rule for rule: the number is
+// [first, last), or stops earlier at a NUL. With `stop` set it only has to
+// be a prefix of the input and *stop is set to where it ended.
+constexpr enum rstatus scan(const char* first, const char* last, const char** stop, number& n) {
+	bool leading = true; // nothing but a sign so far
+	bool point = false;
+	std::size_t total_digits = 0;
+	const char* whitespace = nullptr; // start of the pending whitespace run
+
+	const char* exponent_symbol = nullptr;
+	char exponent_sign = '\0';
+	std::size_t exponent_digits = 0;
+	int exponent = 0;
+
+	const char* p = first;
+	if(stop) {
+		while(p != last && (*p == ' ' || *p == '\t')) ++p;
+	}
+	for(; p != last; ++p) {
+		char_class c = classify(*p);
+		if(c == CLASS_SPACE) {
+			if(!whitespace) whitespace = p;
+			continue;
+		}
+		if(c == CLASS_END) break;
+		if(whitespace) {
+			if(stop && c != CLASS_DIGIT) break;
+			enum rstatus status = use_whitespace(whitespace, p, n);
+			if(status) {
+				if(stop) break;
+				return status;
+			}
+			whitespace = nullptr;
+		}
+
+		enum rstatus status = RSTATUS_OK;
+		if(c == CLASS_MINUS || c == CLASS_EXPONENT_PLUS) {
+			if(exponent_symbol && !exponent_sign && !exponent_digits) {
+				exponent_sign = *p;
+			}
+			else if(c == CLASS_EXPONENT_PLUS || !leading) {
+				status = RSTATUS_MISPLACED_SYMBOL;
+			}
+			else {
+				leading = false;
+				n.negative = true;
+			}
+		}
+		else if(c == CLASS_DIGIT) {
+			unsigned digit = unsigned(*p - '0');
+			leading = false;
+
+			// 0x, 0o or 0b in front of the first digit
+			if(!digit && !total_digits && !point && p + 1 != last) {
+				unsigned bits = radix_bits(p[1]);
+				if(bits && (!stop || (p + 2 != last && digit_value(p[2]) < 1u << bits))) {
+					return scan_radix(p + 1, last, stop, n, bits);
+				}
+			}
+
+			if(exponent_symbol) {
+				++exponent_digits;
+				// anything this large is already zero or infinity
+				if(exponent < 100000) exponent = exponent*10 + int(digit);
+			}
+			else {
+				++total_digits;
+				if(n.ndigits == 0 && digit == 0) {
+					if(point) --n.exponent;
+				}
+				else if(n.ndigits < max_digits) {
+					n.digits[n.ndigits++] = (unsigned char)digit;
+					if(point) --n.exponent;
+				}
+				else {
+					if(digit) n.truncated = true;
+					if(!point) ++n.exponent;
+				}
+			}
+		}
+		else if(c == CLASS_SEPARATOR) {
+			if(stop && !digit_at(p + 1, last)) break;
+			leading = false;
+			status = use_separator(p, n);
+		}
+		else if(c == CLASS_POINT) {
+			if(stop && !digit_at(p + 1, last)) break;
+			if(leading || point || exponent_symbol) {
+				status = RSTATUS_MISPLACED_SYMBOL;
+			}
+			else {
+				point = true;
+				n.floating = true;
+			}
+		}
+		else if(c == CLASS_EXPONENT) {
+			if(stop && !digit_at(p + 1, last) && !(p + 1 != last && (p[1] == '+' || p[1] == '-') && digit_at(p + 2, last))) break;
+			if(!total_digits || exponent_symbol) {
+				status = RSTATUS_MISPLACED_SYMBOL;
+			}
+			else {
+				exponent_symbol = p;
+				n.floating = true;
+			}
+		}
+		else {
+			status = RSTATUS_INVALID_SYMBOL;
+		}
+
+		if(status) {
+			if(stop) break;
+			n.error_at = p;
+			return status;
+		}
+	}
+
+	if(stop) *stop = whitespace ? whitespace : p;
+	if(!total_digits) {
+		if(stop) *stop = first;
+		return RSTATUS_EMPTY;
+	}
+	if(exponent_symbol && !exponent_digits) {
+		n.error_at = exponent_symbol;
+		return RSTATUS_MISSING_EXPONENT;
+	}
+	n.exponent += exponent_sign == '-' ? -exponent : exponent;
+	return RSTATUS_OK;
+}
+
+// parse_integer() of creadable.c for any width: the magnitude is
+// accumulated in the unsigned type and checked digit by digit.
+template<integer T>
+constexpr enum rstatus to_integer(const number& n, T& out) {
+	using U = typename unsigned_of<T>::type;
+	constexpr bool is_signed = T(-1) < T(0);
+	constexpr U max = is_signed ? U(U(~U(0)) >> 1) : U(~U(0));
+	if(n.negative && !is_signed) return RSTATUS_NEGATIVE_UNSIGNED;
+	if(n.floating) return RSTATUS_FLOAT_TO_INTEGER;
+
+	enum rstatus out_of_range = n.negative ? RSTATUS_UNDERFLOW : RSTATUS_OVERFLOW;
+	if(n.truncated) return out_of_range;
+	U limit = n.negative ? U(max + 1) : max;
+	U value = 0;
+	for(int i = 0; i < n.ndigits; ++i) {
+		U digit = n.digits[i];
+		if(value > U(limit - digit)/n.base) return out_of_range;
+		value = U(value*n.base + digit);
+	}
+	// negated without ever holding the magnitude of MIN in T
+	out = n.negative && value ? T(-T(U(value - 1)) - 1) : T(value);
+	return RSTATUS_OK;
+}
+
+// The digits of a number as a decimal fraction 0.d[0]d[1]... * 10^dp that
+// can be multiplied and divided by powers of two exactly (Go's strconv
+// algorithm): the reference conversion, used for whatever the fast path
+// below cannot do.
+struct decimal {
+	unsigned char d[max_digits];
+	int nd = 0;
+	int dp = 0;
+	bool truncated = false; // non-zero digits were dropped past d[max_digits - 1]
+
+	// A shift can move at most this many bits through a 64-bit accumulator.
+	static constexpr unsigned max_shift = 60;
+
+	constexpr explicit decimal(const number& n) : nd(n.ndigits), dp(n.ndigits + n.exponent), truncated(n.truncated) {
+		for(int i = 0; i < nd; ++i) d[i] = n.digits[i];
+		trim();
+	}
+
+	constexpr void trim() {
+		while(nd > 0 && d[nd - 1] == 0) --nd;
+		if(nd == 0) dp = 0;
+	}
+
+	constexpr void right_shift(unsigned k) {
+		int r = 0;
+		int w = 0;
+		std::uint64_t acc = 0;
+		// enough leading digits to shift anything out
+		for(; acc >> k == 0; ++r) {
+			if(r >= nd) {
+				if(acc == 0) {
+					nd = 0;
+					return;
+				}
+				while(acc >> k == 0) {
+					acc *= 10;
+					++r;
+				}
+				break;
+			}
+			acc = acc*10 + d[r];
+		}
+		dp -= r - 1;
+
+		std::uint64_t mask = (std::uint64_t(1) << k) - 1;
+		for(; r < nd; ++r) {
+			std::uint64_t digit = acc >> k;
+			acc &= mask;
+			d[w++] = (unsigned char)digit;
+			acc = acc*10 + d[r];
+		}
+		while(acc > 0) {
+			std::uint64_t digit = acc >> k;
+			acc &= mask;
+			if(w < max_digits) d[w++] = (unsigned char)digit;
+			else if(digit > 0) truncated = true;
+			acc *= 10;
+		}
+		nd = w;
+		trim();
+	}
+
+	constexpr void left_shift(unsigned k) {
+		// the digits come out from the last one, kept reversed until their
+		// count is known
+		unsigned char reversed[max_digits + 20];
+		int count = 0;
+		std::uint64_t acc = 0;
+		for(int r = nd - 1; r >= 0; --r) {
+			acc += std::uint64_t(d[r]) << k;
+			reversed[count++] = (unsigned char)(acc%10);
+			acc /= 10;
+		}
+		while(acc > 0) {
+			reversed[count++] = (unsigned char)(acc%10);
+			acc /= 10;
+		}
+
+		dp += count - nd;
+		nd = count < max_digits ? count : max_digits;
+		for(int i = 0; i < nd; ++i) d[i] = reversed[count - 1 - i];
+		for(int i = nd; i < count; ++i) {
+			if(reversed[count - 1 - i]) truncated = true;
+		}
+		trim();
+	}
+
+	constexpr void shift(int k) {
+		if(nd == 0) return;
+		for(; k > int(max_shift); k -= int(max_shift)) left_shift(max_shift);
+		for(; k < -int(max_shift); k += int(max_shift)) right_shift(max_shift);
+		if(k > 0) left_shift(unsigned(k));
+		else if(k < 0) right_shift(unsigned(-k));
+	}
+
+	// Rounding to nearest, ties to even, at digit `at`.
+	constexpr bool round_up(int at) const {
+		if(at < 0 || at >= nd) return false;
+		if(d[at] == 5 && at + 1 == nd) {
+			if(truncated) return true;
+			return at > 0 && d[at - 1]%2 == 1;
+		}
+		return d[at] >= 5;
+	}
+};
+
+// A shift by at most as many bits as 10^digits has, so that scaling a
+// number below 10^-digits up never takes it past 1.
+constexpr int shift_for(int digits) {
+	constexpr int powers[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+	return digits < 9 ? powers[digits] : digits*3321/1000;
+}
+
+// The largest q such that 10^q is exact in T, i.e. 5^q < 2^digits.
+template<floating T>
+constexpr int max_exact_power() {
+	constexpr int digits = std::numeric_limits<T>::digits;
+	constexpr std::uint64_t limit = digits >= 64 ? ~std::uint64_t(0) : std::uint64_t(1) << digits;
+	int q = 0;
+	for(std::uint64_t five = 1; five <= (limit - 1)/5; five *= 5) ++q;
+	return q;
+}
+
+template<floating T>
+constexpr T power_of_ten(int q) {
+	T ret = 1;
+	for(; q > 0; --q) ret *= 10;
+	return ret;
+}
+
+// value * 2^e in steps that are all exact, since the result is.
+template<floating T>
+constexpr T scale(T value, int e) {
+	for(; e > 0; e -= e > 60 ? 60 : e) value *= T(std::uint64_t(1) << (e > 60 ? 60 : e));
+	for(; e < 0; e += -e > 60 ? 60 : -e) value /= T(std::uint64_t(1) << (-e > 60 ? 60 : -e));
+	return value;
+}
+
+// The gathered digits as "<digits>e<exponent>" through strto*(), which is
+// what creadable.c does for long double: with no decimal mark the result
+// does not depend on the locale. Dropped digits become a sticky 1.
+template<floating T>
+inline T from_digits(const number& n) {
+	char text[max_digits + 16];
+	char* p = text;
+	int exponent = n.exponent;
+	for(int i = 0; i < n.ndigits; ++i) *p++ = char('0' + n.digits[i]);
+	if(n.truncated) {
+		*p++ = '1';
+		--exponent;
+	}
+	if(p == text) *p++ = '0';
+	*p++ = 'e';
+	if(exponent < 0) *p++ = '-';
+	unsigned magnitude = exponent < 0 ? 0u - unsigned(exponent) : unsigned(exponent);
+	char reversed[16];
+	int length = 0;
+	do {
+		reversed[length++] = char('0' + magnitude%10);
+		magnitude /= 10;
+	} while(magnitude);
+	while(length) *p++ = reversed[--length];
+	*p = '\0';
+
+	if constexpr(std::is_same_v<T, float>) return std::strtof(text, nullptr);
+	else if constexpr(std::is_same_v<T, double>) return std::strtod(text, nullptr);
+	else return std::strtold(text, nullptr);
+}
+
+// Correctly rounded conversion of the gathered digits. Returns
+// RSTATUS_OVERFLOW or RSTATUS_UNDERFLOW when out only came to infinity or
+// to zero: the C functions accept those and so do the runtime variants,
+// literals do not, so only the compile time conversion tells them apart.
+template<floating T>
+constexpr enum rstatus to_floating(const number& n, T& out) {
+	using limits = std::numeric_limits<T>;
+	constexpr int mantissa_bits = limits::digits - 1;
+	constexpr std::uint64_t max_mantissa = limits::digits >= 64 ? ~std::uint64_t(0) : (std::uint64_t(1) << limits::digits) - 1;
+	constexpr int max_power = max_exact_power<T>();
+
+	T value = 0;
+	enum rstatus status = RSTATUS_OK;
+
+	// Clinger's fast path: the digits and the power of ten are both exact,
+	// so one multiplication or division rounds correctly (unless it is
+	// carried out in a wider type and rounded twice)
+	if((FLT_EVAL_METHOD == 0 || std::is_same_v<T, long double>) && n.ndigits <= 19 && !n.truncated && n.exponent >= -max_power && n.exponent <= max_power) {
+		std::uint64_t w = 0;
+		for(int i = 0; i < n.ndigits; ++i) w = w*10 + n.digits[i];
+		if(w <= max_mantissa) {
+			value = T(w);
+			value = n.exponent < 0 ? value/power_of_ten<T>(-n.exponent) : value*power_of_ten<T>(n.exponent);
+			out = n.negative ? -value : value;
+			return RSTATUS_OK;
+		}
+	}
+
+	// the decimal shifts take microseconds on long numbers, the C library
+	// does better at run time
+	if(!std::is_constant_evaluated()) {
+		value = from_digits<T>(n);
+		out = n.negative ? -value : value;
+		return RSTATUS_OK;
+	}
+
+	decimal d(n);
+	if(d.nd == 0) {
+		value = 0;
+	}
+	else if(d.dp > limits::max_exponent10 + 2) {
+		value = limits::infinity();
+		status = RSTATUS_OVERFLOW;
+	}
+	else if(d.dp < limits::min_exponent10 - limits::max_digits10 - 10) {
+		value = 0;
+		status = RSTATUS_UNDERFLOW;
+	}
+	else {
+		// scale into [0.5, 1) by powers of two, keeping count in exp
+		int exp = 0;
+		while(d.dp > 0) {
+			int k = shift_for(d.dp);
+			d.shift(-k);
+			exp += k;
+		}
+		while(d.dp < 0 || (d.dp == 0 && d.d[0] < 5)) {
+			int k = shift_for(-d.dp);
+			d.shift(k);
+			exp -= k;
+		}
+		--exp; // [0.5, 1) is [1, 2) * 2^-1
+
+		// subnormal: fewer bits are left for the mantissa
+		if(exp < limits::min_exponent - 1) {
+			int k = limits::min_exponent - 1 - exp;
+			d.shift(-k);
+			exp += k;
+		}
+
+		d.shift(mantissa_bits + 1);
+		std::uint64_t mantissa = 0;
+		int i = 0;
+		for(; i < d.dp && i < d.nd; ++i) mantissa = mantissa*10 + d.d[i];
+		for(; i < d.dp; ++i) mantissa *= 10;
+		if(d.round_up(d.dp)) {
+			// rounding can carry into one more bit
+			if(mantissa == max_mantissa) {
+				mantissa = std::uint64_t(1) << mantissa_bits;
+				++exp;
+			}
+			else {
+				++mantissa;
+			}
+		}
+
+		if(exp >= limits::max_exponent) {
+			value = limits::infinity();
+			status = RSTATUS_OVERFLOW;
+		}
+		else {
+			value = scale(T(mantissa), exp - mantissa_bits);
+			if(value == 0) status = RSTATUS_UNDERFLOW;
+		}
+	}
+
+	out = n.negative ? -value : value;
+	return status;
+}
+
+// The whole pipeline; out is only written on success. `literal` keeps the
+// floating point range errors, which the C functions do not report.
+template<parsable T>
+constexpr enum rstatus parse(const char* first, const char* last, const char** stop, number& n, T& out, bool literal) {
+	enum rstatus status = scan(first, last, stop, n);
+	if(status) return status;
+
+	T value{};
+	if constexpr(integer<T>) {
+		status = to_integer(n, value);
+	}
+	else {
+		if(!n.floating) return RSTATUS_INTEGER_TO_FLOAT;
+		status = to_floating(n, value);
+		if(!literal && (status == RSTATUS_OVERFLOW || status == RSTATUS_UNDERFLOW)) status = RSTATUS_OK;
+	}
+	if(!status) out = value;
+	return status;
+}
+
+// A literal that does not parse calls one of these, which cannot be called
+// at compile time: the compiler error names the problem.
+inline void literal_is_empty() {}
+inline void literal_has_invalid_symbol() {}
+inline void literal_mixes_separators() {}
+inline void literal_has_misplaced_symbol() {}
+inline void literal_misses_exponent() {}
+inline void literal_overflows() {}
+inline void literal_underflows() {}
+inline void literal_is_negative() {}
+inline void literal_is_not_an_integer() {}
+inline void literal_is_not_floating() {}
+
+constexpr void reject(enum rstatus status) {
+	switch(status) {
+	case RSTATUS_OK:
+		break;
+	case RSTATUS_EMPTY:
+		literal_is_empty();
+		break;
+	case RSTATUS_INVALID_SYMBOL:
+		literal_has_invalid_symbol();
+		break;
+	case RSTATUS_SEPARATOR_MISMATCH:
+		literal_mixes_separators();
+		break;
+	case RSTATUS_MISPLACED_SYMBOL:
+		literal_has_misplaced_symbol();
+		break;
+	case RSTATUS_MISSING_EXPONENT:
+		literal_misses_exponent();
+		break;
+	case RSTATUS_OVERFLOW:
+		literal_overflows();
+		break;
+	case RSTATUS_UNDERFLOW:
+		literal_underflows();
+		break;
+	case RSTATUS_NEGATIVE_UNSIGNED:
+		literal_is_negative();
+		break;
+	case RSTATUS_FLOAT_TO_INTEGER:
+		literal_is_not_an_integer();
+		break;
+	case RSTATUS_INTEGER_TO_FLOAT:
+		literal_is_not_floating();
+		break;
+	default:
+		break;
+	}
+}
+
+} // namespace detail
+
+// Reads the number at the start of [first, last) like the _r*_n()
+// functions: leading whitespace is skipped and parsing stops at the first
+// character that cannot continue the number. value is left alone on error.
+template<detail::parsable T>
+constexpr result from_chars(const char* first, const char* last, T& value) {
+	detail::number n;
+	const char* stop = first;
+	enum rstatus status = detail::parse(first, last, &stop, n, value, false);
+	return {stop, status};
+}
+
+// Reads the whole of text like the r*_ex() functions. value is left alone
+// on error.
+template<detail::parsable T>
+constexpr result parse(std::string_view text, T& value) {
+	detail::number n;
+	const char* first = text.data();
+	const char* last = first + text.size();
+	enum rstatus status = detail::parse(first, last, nullptr, n, value, false);
+	if(!status) return {last, status};
+	return {n.error_at ? n.error_at : first, status};
+}
+
+// The value of a literal, computed by the compiler. Unlike the runtime
+// variants, a floating point literal that only comes to infinity or to zero
+// is an error too.
+template<detail::parsable T>
+consteval T parse(std::string_view literal) {
+	detail::number n;
+	T value{};
+	detail::reject(detail::parse(literal.data(), literal.data() + literal.size(), nullptr, n, value, true));
+	return value;
+}
+
+namespace literals {
+
+#define CREADABLE_LITERAL(name, type) \
+	consteval type operator"" _r##name(const char* literal, std::size_t length) { \
+		return parse<type>(std::string_view(literal, length)); \
+	}
+
+CREADABLE_LITERAL(char, char)
+CREADABLE_LITERAL(schar, signed char)
+CREADABLE_LITERAL(uchar, unsigned char)
+
+CREADABLE_LITERAL(short, short)
+CREADABLE_LITERAL(ushort, unsigned short)
+
+CREADABLE_LITERAL(int, int)
+CREADABLE_LITERAL(uint, unsigned int)
+
+CREADABLE_LITERAL(long, long)
+CREADABLE_LITERAL(longlong, long long)
+CREADABLE_LITERAL(ulong, unsigned long)
+CREADABLE_LITERAL(ulonglong, unsigned long long)
+
+CREADABLE_LITERAL(float, float)
+
+CREADABLE_LITERAL(double, double)
+CREADABLE_LITERAL(longdouble, long double)
+
+#ifdef __SIZEOF_INT128__
+CREADABLE_LITERAL(i128, detail::int128)
+CREADABLE_LITERAL(u128, detail::uint128)
+#endif
+
+#undef CREADABLE_LITERAL
+
+} // namespace literals
+
+} // namespace creadable
+
+#endif
@@ -0,0 +1,880 @@
+#define _POSIX_C_SOURCE 199309L
+#define _DEFAULT_SOURCE
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <stdarg.h>
+#include <time.h>
+#include <unistd.h>
+#include <locale.h>
+#include <math.h>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#define CREADABLE_CACHE
+#include "../src/creadable.h"
+
+// ===========================
+// Hardware counters
+// ===========================
+// Cycles, instructions and branch misses of the calling thread, read with
+// perf_event_open when the kernel allows it (see perf_event_paranoid).
+// Without them only the timings are reported.
+enum { CYCLES, INSTRUCTIONS, BRANCH_MISSES, COUNTERS };
+
+static const char* const counter_names[COUNTERS] = {"cycles", "instructions", "branch_misses"};
+static int counter_fds[COUNTERS] = {-1, -1, -1};
+static int counters_available = 0;
+
+static void counters_close(void) {
+    for(int i = 0; i < COUNTERS; ++i) {
+        if(counter_fds[i] >= 0) close(counter_fds[i]);
+        counter_fds[i] = -1;
+    }
+    counters_available = 0;
+}
+
+static void counters_open(void) {
+#ifdef __linux__
+    static const unsigned long long configs[COUNTERS] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES
+    };
+    for(int i = 0; i < COUNTERS; ++i) {
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = configs[i];
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        counter_fds[i] = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        if(counter_fds[i] < 0) {
+            counters_close();
+            return;
+        }
+    }
+    counters_available = 1;
+#endif
+}
+
+// ===========================
+// Benchmark framework
+// ===========================
+#define ITERATIONS 10000000L
+#define MAX_RESULTS 512
+
+static volatile long double sink;
+
+struct measurement {
+    double start;
+    double elapsed;
+    int counted;
+    long long counts[COUNTERS];
+};
+
+struct result {
+    char section[64];
+    char name[80];
+    double ns_per_op;
+    double values_per_s;
+    double bytes_per_s; // 0 when the benchmark has no input size
+    int counted;
+    double per_op[COUNTERS];
+};
+
+static struct result results[MAX_RESULTS];
+static size_t nresults = 0;
+static char section[64];
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static void measure_start(struct measurement* m) {
+#ifdef __linux__
+    for(int i = 0; counters_available && i < COUNTERS; ++i) {
+        ioctl(counter_fds[i], PERF_EVENT_IOC_RESET, 0);
+        ioctl(counter_fds[i], PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+    m->start = now();
+}
+
+static void measure_stop(struct measurement* m) {
+    m->elapsed = now() - m->start;
+    m->counted = 0;
+#ifdef __linux__
+    if(!counters_available) return;
+    m->counted = 1;
+    for(int i = 0; i < COUNTERS; ++i) {
+        ioctl(counter_fds[i], PERF_EVENT_IOC_DISABLE, 0);
+        if(read(counter_fds[i], &m->counts[i], sizeof(m->counts[i])) != sizeof(m->counts[i])) m->counted = 0;
+    }
+#endif
+}
+
+static void begin_section(const char* format, ...) {
+    va_list args;
+    va_start(args, format);
+    vsnprintf(section, sizeof(section), format, args);
+    va_end(args);
+    printf("\n==== %s ====\n", section);
+}
+
+// Prints one line and keeps it for the JSON report. bytes is the input
+// size behind `ops` values, or 0.
+static void report(const char* name, const struct measurement* m, double ops, double bytes) {
+    struct result r = {0};
+    snprintf(r.section, sizeof(r.section), "%s", section);
+    snprintf(r.name, sizeof(r.name), "%s", name);
+    r.ns_per_op = m->elapsed*1e9/ops;
+    r.values_per_s = ops/m->elapsed;
+    r.bytes_per_s = bytes/m->elapsed;
+    r.counted = m->counted;
+    for(int i = 0; i < COUNTERS; ++i) r.per_op[i] = m->counted ? m->counts[i]/ops : 0;
+    if(nresults < MAX_RESULTS) results[nresults++] = r;
+
+    printf("%-44s %8.2f ns/op %9.2f Mvalues/s", name, r.ns_per_op, r.values_per_s/1e6);
+    if(bytes) printf(" %7.3f GB/s", r.bytes_per_s/1e9);
+    if(r.counted) {
+        printf("  %7.1f cyc %7.1f ins %5.2f br-miss", r.per_op[CYCLES], r.per_op[INSTRUCTIONS], r.per_op[BRANCH_MISSES]);
+    }
+    printf("\n");
+}
+
+#define BENCH_N(label, iterations, expr) do { \
+    struct measurement m; \
+    measure_start(&m); \
+    for(long i = 0; i < (iterations); ++i) sink = (expr); \
+    measure_stop(&m); \
+    report(label, &m, (double)(iterations), 0); \
+} while(0)
+
+#define BENCH(label, expr) BENCH_N(label, ITERATIONS, expr)
+
+static void json_string(FILE* out, const char* s) {
+    fputc('"', out);
+    for(; *s; ++s) {
+        if(*s == '"' || *s == '\\') fputc('\\', out);
+        fputc(*s, out);
+    }
+    fputc('"', out);
+}
+
+static int write_json(const char* path) {
+    FILE* out = fopen(path, "w");
+    if(!out) return 0;
+    fprintf(out, "{\n  \"counters\": %s,\n  \"results\": [\n", counters_available ? "true" : "false");
+    for(size_t i = 0; i < nresults; ++i) {
+        const struct result* r = &results[i];
+        fprintf(out, "    {\"section\": ");
+        json_string(out, r->section);
+        fprintf(out, ", \"name\": ");
+        json_string(out, r->name);
+        fprintf(out, ", \"ns_per_op\": %.3f, \"values_per_s\": %.1f", r->ns_per_op, r->values_per_s);
+        if(r->bytes_per_s) fprintf(out, ", \"bytes_per_s\": %.1f", r->bytes_per_s);
+        for(int c = 0; r->counted && c < COUNTERS; ++c) fprintf(out, ", \"%s_per_op\": %.3f", counter_names[c], r->per_op[c]);
+        fprintf(out, "}%s\n", i + 1 < nresults ? "," : "");
+    }
+    fprintf(out, "  ]\n}\n");
+    return fclose(out) == 0;
+}
+
+// ===========================
+// Input shapes
+// ===========================
+// Every _r*() function on the same shapes of input, next to the strto*()
+// function of the same type parsing the separator-free spelling.
+#define SHAPES 8
+#define SHAPE_ITERATIONS 2000000L
+
+static const char* const shape_names[SHAPES] = {
+    "short", "long", "underscores", "commas", "spaces", "negative", "boundary", "invalid"
+};
+
+#define SIGNED_SHAPES(max, max_, max_comma, max_space, negative, min, invalid) \
+    {"7", max, max_, max_comma, max_space, negative, min, invalid}
+#define UNSIGNED_SHAPES(max, max_, max_comma, max_space, invalid) \
+    {"7", max, max_, max_comma, max_space, NULL, max_comma, invalid}
+
+static const char* const char_shapes[SHAPES] = SIGNED_SHAPES("127", "1_27", "1,27", "1 27", "-100", "-128", "1a7");
+static const char* const uchar_shapes[SHAPES] = UNSIGNED_SHAPES("255", "2_55", "2,55", "2 55", "2a5");
+static const char* const short_shapes[SHAPES] = SIGNED_SHAPES("32767", "32_767", "32,767", "32 767", "-12_345", "-32,768", "32a67");
+static const char* const ushort_shapes[SHAPES] = UNSIGNED_SHAPES("65535", "65_535", "65,535", "65 535", "65a35");
+static const char* const int_shapes[SHAPES] = SIGNED_SHAPES(
+    "2147483647", "2_147_483_647", "2,147,483,647", "2 147 483 647", "-1_234_567", "-2,147,483,648", "2147a83647"
+);
+static const char* const uint_shapes[SHAPES] = UNSIGNED_SHAPES(
+    "4294967295", "4_294_967_295", "4,294,967,295", "4 294 967 295", "4294a67295"
+);
+static const char* const longlong_shapes[SHAPES] = SIGNED_SHAPES(
+    "9223372036854775807", "9_223_372_036_854_775_807", "9,223,372,036,854,775,807", "9 223 372 036 854 775 807",
+    "-1_234_567_890_123", "-9,223,372,036,854,775,808", "92233720a6854775807"
+);
+static const char* const ulonglong_shapes[SHAPES] = UNSIGNED_SHAPES(
+    "18446744073709551615", "18_446_744_073_709_551_615", "18,446,744,073,709,551,615", "18 446 744 073 709 551 615",
+    "1844674407a709551615"
+);
+#define FLOAT_SHAPES(max) \
+    {"0.5", "1234567.891011", "1_234_567.891_011", "1,234,567.891011", "1 234 567.891 011", "-0.000_123_4", max, "3.14a59"}
+static const char* const float_shapes[SHAPES] = FLOAT_SHAPES("3.4028235e38");
+static const char* const double_shapes[SHAPES] = FLOAT_SHAPES("1.7976931348623157e308");
+static const char* const longdouble_shapes[SHAPES] = FLOAT_SHAPES("1.18973149535723176502e4932");
+
+static void strip_separators(const char* input, char* plain) {
+    for(; *input; ++input) {
+        if(*input != '_' && *input != ',' && *input != ' ') *plain++ = *input;
+    }
+    *plain = '\0';
+}
+
+// strto*() accepts trailing garbage, so it is not timed on invalid input
+#define BENCH_SHAPES(name, shapes, competitor, competitor_expr) do { \
+    for(int s = 0; s < SHAPES; ++s) { \
+        if(!shapes[s]) continue; \
+        char label[80], plain[64]; \
+        char* input = (char*)shapes[s]; \
+        snprintf(label, sizeof(label), "_r%s %s", #name, shape_names[s]); \
+        BENCH_N(label, SHAPE_ITERATIONS, _r##name(input)); \
+        if(s == SHAPES - 1) continue; \
+        strip_separators(shapes[s], plain); \
+        input = plain; \
+        snprintf(label, sizeof(label), "%s %s", competitor, shape_names[s]); \
+        BENCH_N(label, SHAPE_ITERATIONS, competitor_expr); \
+    } \
+} while(0)
+
+static void drop_error(enum rstatus status, const char* message, void* context) {
+    (void)status;
+    (void)message;
+    (void)context;
+}
+
+static void bench_shapes(void) {
+    // invalid input still goes through the rate limited report path,
+    // it just isn't printed
+    rset_error_handler(drop_error, NULL, CREADABLE_ERROR_RATE);
+
+    BENCH_SHAPES(char, char_shapes, "strtol", strtol(input, NULL, 10));
+    BENCH_SHAPES(schar, char_shapes, "strtol", strtol(input, NULL, 10));
+    BENCH_SHAPES(uchar, uchar_shapes, "strtoul", strtoul(input, NULL, 10));
+    BENCH_SHAPES(short, short_shapes, "strtol", strtol(input, NULL, 10));
+    BENCH_SHAPES(ushort, ushort_shapes, "strtoul", strtoul(input, NULL, 10));
+    BENCH_SHAPES(int, int_shapes, "strtol", strtol(input, NULL, 10));
+    BENCH_SHAPES(uint, uint_shapes, "strtoul", strtoul(input, NULL, 10));
+    BENCH_SHAPES(long, longlong_shapes, "strtol", strtol(input, NULL, 10));
+    BENCH_SHAPES(longlong, longlong_shapes, "strtoll", strtoll(input, NULL, 10));
+    BENCH_SHAPES(ulong, ulonglong_shapes, "strtoul", strtoul(input, NULL, 10));
+    BENCH_SHAPES(ulonglong, ulonglong_shapes, "strtoull", strtoull(input, NULL, 10));
+    BENCH_SHAPES(float, float_shapes, "strtof", strtof(input, NULL));
+    BENCH_SHAPES(double, double_shapes, "strtod", strtod(input, NULL));
+    BENCH_SHAPES(longdouble, longdouble_shapes, "strtold", strtold(input, NULL));
+
+    rset_error_handler(NULL, NULL, CREADABLE_ERROR_RATE);
+}
+
+// ===========================
+// Corpus benchmarks
+// ===========================
+#define CORPUS_SIZE 100000
+
+static char corpus[CORPUS_SIZE][32];
+static size_t corpus_bytes;
+
+// Random finite doubles: half of them printed in full (17 digits with an
+// exponent), half as short fixed-point amounts.
+static void build_float_corpus(void) {
+    srand(1234);
+    corpus_bytes = 0;
+    for(int i = 0; i < CORPUS_SIZE; ++i) {
+        if(i % 2) {
+            double value;
+            do {
+                uint64_t bits = ((uint64_t)rand() << 42) ^ ((uint64_t)rand() << 21) ^ (uint64_t)rand();
+                memcpy(&value, &bits, sizeof(value));
+            } while(value != value || value - value != 0);
+            sprintf(corpus[i], "%.16e", value);
+        } else {
+            sprintf(corpus[i], "%d.%02d", rand() % 100000, rand() % 100);
+        }
+        corpus_bytes += strlen(corpus[i]);
+    }
+}
+
+#define BENCH_CORPUS(label, rounds, expr) do { \
+    struct measurement m; \
+    measure_start(&m); \
+    for(int round = 0; round < (rounds); ++round) { \
+        for(int i = 0; i < CORPUS_SIZE; ++i) { \
+            char* input = corpus[i]; \
+            sink = (expr); \
+        } \
+    } \
+    measure_stop(&m); \
+    report(label, &m, (double)(rounds)*CORPUS_SIZE, (double)(rounds)*corpus_bytes); \
+} while(0)
+
+static double validate_double;
+static long long validate_longlong;
+
+// Random 64-bit values in hexadecimal, with and without '_' every four
+// digits, in octal and, cut to 28 bits, in binary.
+enum radix_shape {RADIX_HEX, RADIX_HEX_GROUPED, RADIX_OCTAL, RADIX_BINARY};
+
+static void build_radix_corpus(enum radix_shape shape) {
+    srand(4321);
+    corpus_bytes = 0;
+    for(int i = 0; i < CORPUS_SIZE; ++i) {
+        unsigned long long value = (unsigned long long)rand() << 42 ^ (unsigned long long)rand() << 21 ^ (unsigned long long)rand();
+        value >>= rand() % 64;
+        char* p = corpus[i];
+        switch(shape) {
+        case RADIX_HEX:
+            sprintf(p, "0x%llx", value);
+        break;
+        case RADIX_HEX_GROUPED: {
+            char digits[24];
+            int length = sprintf(digits, "%llx", value);
+            p += sprintf(p, "0x");
+            for(int k = 0; k < length; ++k) {
+                if(k && (length - k) % 4 == 0) *p++ = '_';
+                *p++ = digits[k];
+            }
+            *p = '\0';
+        }
+        break;
+        case RADIX_OCTAL:
+            sprintf(p, "0o%llo", value);
+        break;
+        case RADIX_BINARY:
+            value &= (1ULL << 28) - 1;
+            p += sprintf(p, "0b");
+            for(int bit = 63 - (value ? __builtin_clzll(value) : 63); bit >= 0; --bit) *p++ = (char)('0' + (value >> bit & 1));
+            *p = '\0';
+        break;
+        }
+        corpus_bytes += strlen(corpus[i]);
+    }
+}
+
+// strtoull(..., 0) knows 0x but not 0o or 0b, which are skipped for it
+static void bench_radix(void) {
+    build_radix_corpus(RADIX_HEX);
+    BENCH_CORPUS("_rulonglong hex", 20, _rulonglong(input));
+    BENCH_CORPUS("strtoull(..., 0) hex", 20, strtoull(input, NULL, 0));
+    build_radix_corpus(RADIX_HEX_GROUPED);
+    BENCH_CORPUS("_rulonglong hex with '_'", 20, _rulonglong(input));
+    build_radix_corpus(RADIX_OCTAL);
+    BENCH_CORPUS("_rulonglong octal", 20, _rulonglong(input));
+    BENCH_CORPUS("strtoull(..., 8) octal", 20, strtoull(input + 2, NULL, 8));
+    build_radix_corpus(RADIX_BINARY);
+    BENCH_CORPUS("_rulonglong binary", 20, _rulonglong(input));
+    BENCH_CORPUS("strtoull(..., 2) binary", 20, strtoull(input + 2, NULL, 2));
+}
+
+// ===========================
+// Validation
+// ===========================
+
+// Long runs of digits, where extract_number measures the run with the
+// dispatched kernel and the conversions take sixteen digits at once.
+static char long_digits[2][800];
+
+static void bench_digit_runs(void) {
+    for(int i = 0; i < 2; ++i) {
+        int length = i ? 760 : 100;
+        for(int j = 0; j < length; ++j) long_digits[i][j] = (char)('0' + (j*7 + 3) % 10);
+        long_digits[i][length/2] = '.';
+        long_digits[i][length] = '\0';
+    }
+    BENCH("_rulonglong(\"18446744073709551615\")", _rulonglong("18446744073709551615"));
+    BENCH("_rdouble(\"3.1415926535897932384626\")", _rdouble("3.1415926535897932384626"));
+    BENCH_N("_rdouble(100 digits)", 2000000L, _rdouble(long_digits[0]));
+    BENCH_N("_rdouble(760 digits)", 200000L, _rdouble(long_digits[1]));
+    BENCH("rvalidate(\"1234567890123456789012345678901234567890.5\")", rvalidate("1234567890123456789012345678901234567890.5", 42).status);
+}
+
+// rvalidate() against the full parsers on the same well formed corpora:
+// the float corpus, and '_' grouped integers like the batch benchmark's.
+static void bench_validate(void) {
+    build_float_corpus();
+    BENCH_CORPUS("rvalidate floats", 20, rvalidate(input, strlen(input)).status);
+    BENCH_CORPUS("rdouble_ex floats", 20, rdouble_ex(input, &validate_double).status);
+
+    srand(77);
+    corpus_bytes = 0;
+    for(int i = 0; i < CORPUS_SIZE; ++i) {
+        long long value = ((long long)rand() << 31 | rand()) % 1000000000000LL - 500000000000LL;
+        char plain[24];
+        int len = sprintf(plain, "%lld", value < 0 ? -value : value);
+        char* p = corpus[i];
+        if(value < 0) *p++ = '-';
+        for(int j = 0; j < len; ++j) {
+            if(j && (len - j) % 3 == 0) *p++ = '_';
+            *p++ = plain[j];
+        }
+        *p = '\0';
+        corpus_bytes += strlen(corpus[i]);
+    }
+    BENCH_CORPUS("rvalidate integers", 20, rvalidate(input, strlen(input)).status);
+    BENCH_CORPUS("rlonglong_ex integers", 20, rlonglong_ex(input, &validate_longlong).status);
+
+    static const char* numbers[CORPUS_SIZE];
+    static long long out[CORPUS_SIZE];
+    static unsigned char invalid[CORPUS_SIZE/8 + 1];
+    for(int i = 0; i < CORPUS_SIZE; ++i) numbers[i] = corpus[i];
+    struct measurement m;
+    measure_start(&m);
+    for(int round = 0; round < 20; ++round) sink = rvalidate_batch(numbers, CORPUS_SIZE, invalid);
+    measure_stop(&m);
+    report("rvalidate_batch integers", &m, 20.0*CORPUS_SIZE, 20.0*corpus_bytes);
+    measure_start(&m);
+    for(int round = 0; round < 20; ++round) sink = rparse_batch_longlong(numbers, CORPUS_SIZE, out, NULL, 1);
+    measure_stop(&m);
+    report("rparse_batch_longlong integers", &m, 20.0*CORPUS_SIZE, 20.0*corpus_bytes);
+}
+
+// ===========================
+// Fixed point
+// ===========================
+static char plain_corpus[CORPUS_SIZE][32];
+
+// what callers did before rdecimal: parse a double, scale it, round it
+static int64_t cents_from_double(double amount) {
+    double scaled = amount*100;
+    return (int64_t)(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+static void bench_fixed(void) {
+    // amounts like 1,234,567.89, and the same without grouping for strtod
+    srand(21);
+    corpus_bytes = 0;
+    for(int i = 0; i < CORPUS_SIZE; ++i) {
+        long long units = ((long long)rand() << 31 | rand()) % 100000000000LL;
+        char plain[24];
+        int len = sprintf(plain, "%lld", units);
+        char* p = corpus[i];
+        if(rand() % 4 == 0) *p++ = '-';
+        for(int j = 0; j < len; ++j) {
+            if(j && (len - j) % 3 == 0) *p++ = ',';
+            *p++ = plain[j];
+        }
+        sprintf(p, ".%02d", rand() % 100);
+        strip_separators(corpus[i], plain_corpus[i]);
+        corpus_bytes += strlen(corpus[i]);
+    }
+
+    int64_t cents;
+    double amount;
+    BENCH_CORPUS("rdecimal_i64(scale 2, half even)", 20, rdecimal_i64(input, 2, RROUND_HALF_EVEN, &cents).status + cents);
+    BENCH_CORPUS("rdecimal_i64(scale 2, exact)", 20, rdecimal_i64(input, 2, RROUND_EXACT, &cents).status + cents);
+    BENCH_CORPUS("rdouble_ex, *100 and round", 20, (rdouble_ex(input, &amount), cents_from_double(amount)));
+    BENCH_CORPUS("strtod (no separators), *100 and round", 20, ((void)input, cents_from_double(strtod(plain_corpus[i], NULL))));
+}
+
+// ===========================
+// Big integers
+// ===========================
+
+// What a caller without rbig_ex() would write: the number times 10^19 plus
+// the next 19 digits, over and over, quadratic in the length.
+static size_t big_by_hand(const char* digits, size_t length, uint64_t* limbs) {
+    size_t count = 0;
+    for(size_t i = 0; i < length;) {
+        size_t take = i ? 19 : (length - 1) % 19 + 1;
+        uint64_t chunk = 0, factor = 1;
+        for(size_t j = 0; j < take; ++j) chunk = chunk*10 + (uint64_t)(digits[i + j] - '0'), factor *= 10;
+        i += take;
+        uint64_t carry = chunk;
+        for(size_t j = 0; j < count; ++j) {
+            unsigned __int128 product = (unsigned __int128)limbs[j]*factor + carry;
+            limbs[j] = (uint64_t)product;
+            carry = (uint64_t)(product >> 64);
+        }
+        if(carry) limbs[count++] = carry;
+    }
+    return count;
+}
+
+// 10 to 10^6 digits, to show how the time grows with the length.
+static void bench_big(void) {
+    for(size_t length = 10; length <= 1000000; length *= 10) {
+        char* digits = malloc(length + 1);
+        srand(25);
+        for(size_t i = 0; i < length; ++i) digits[i] = (char)('0' + rand() % 10);
+        digits[0] = '7';
+        digits[length] = '\0';
+        size_t size = rbig_workspace(length);
+        uint64_t* workspace = malloc(size*sizeof(uint64_t));
+        long rounds = (long)(20000000/length/(length/1000 + 1)) + 1;
+        struct rbig big;
+        char label[64];
+
+        struct measurement m;
+        snprintf(label, sizeof(label), "rbig_ex(%zu digits)", length);
+        measure_start(&m);
+        for(long r = 0; r < rounds; ++r) sink = rbig_ex(digits, length, workspace, size, &big).status + (int)big.count;
+        measure_stop(&m);
+        report(label, &m, (double)rounds, (double)rounds*length);
+
+        snprintf(label, sizeof(label), "19 digits at a time by hand (%zu digits)", length);
+        measure_start(&m);
+        for(long r = 0; r < rounds; ++r) sink = (int)big_by_hand(digits, length, workspace);
+        measure_stop(&m);
+        report(label, &m, (double)rounds, (double)rounds*length);
+
+        free(workspace);
+        free(digits);
+    }
+}
+
+// ===========================
+// Formatting
+// ===========================
+#define FORMAT_VALUES 100000
+
+static unsigned long long format_values[FORMAT_VALUES];
+static double format_doubles[FORMAT_VALUES];
+
+// the shortest text printf can give that reads back to value
+static size_t shortest_by_hand(double value, char* buffer, size_t size) {
+    int length = 0;
+    for(int precision = 1; precision <= 17; ++precision) {
+        length = snprintf(buffer, size, "%.*g", precision, value);
+        if(strtod(buffer, NULL) == value) break;
+    }
+    return (size_t)length;
+}
+
+// what callers did before rformat: snprintf, then insert the commas
+static size_t group_by_hand(unsigned long long value, char* buffer, size_t size) {
+    char plain[24];
+    int digits = snprintf(plain, sizeof(plain), "%llu", value);
+    size_t length = digits + (digits - 1)/3;
+    if(length >= size) return length;
+    char* p = buffer;
+    for(int i = 0; i < digits; ++i) {
+        if(i && (digits - i) % 3 == 0) *p++ = ',';
+        *p++ = plain[i];
+    }
+    *p = '\0';
+    return length;
+}
+
+#define BENCH_FORMAT(label, rounds, values, expr) do { \
+    struct measurement m; \
+    char buffer[32]; \
+    size_t bytes = 0; \
+    measure_start(&m); \
+    for(int round = 0; round < (rounds); ++round) { \
+        for(int i = 0; i < FORMAT_VALUES; ++i) { \
+            __typeof__((values)[0]) value = (values)[i]; \
+            bytes += (expr); \
+        } \
+    } \
+    measure_stop(&m); \
+    sink = buffer[0]; \
+    report(label, &m, (double)(rounds)*FORMAT_VALUES, (double)bytes); \
+} while(0)
+
+static void bench_format(void) {
+    srand(31);
+    for(int i = 0; i < FORMAT_VALUES; ++i) {
+        unsigned long long value = (unsigned long long)rand() << 42 ^ (unsigned long long)rand() << 21 ^ (unsigned long long)rand();
+        format_values[i] = value >> rand() % 64;
+    }
+
+    const char* locale = setlocale(LC_NUMERIC, "en_US.UTF-8");
+    if(!locale) locale = setlocale(LC_NUMERIC, "");
+    char grouped[32];
+    snprintf(grouped, sizeof(grouped), "%'llu", 1000000ULL);
+    printf("snprintf locale: %s (%s)\n", locale ? locale : "C", strchr(grouped, ',') ? "grouped" : "no grouping");
+
+    BENCH_FORMAT("rformat_ulonglong(',')", 50, format_values, rformat_ulonglong(value, ',', buffer, sizeof(buffer)));
+    BENCH_FORMAT("snprintf(\"%'llu\")", 50, format_values, (size_t)snprintf(buffer, sizeof(buffer), "%'llu", value));
+    BENCH_FORMAT("snprintf(\"%llu\") + grouping loop", 50, format_values, group_by_hand(value, buffer, sizeof(buffer)));
+    BENCH_FORMAT("rformat_ulonglong(no separator)", 50, format_values, rformat_ulonglong(value, 0, buffer, sizeof(buffer)));
+    BENCH_FORMAT("snprintf(\"%llu\")", 50, format_values, (size_t)snprintf(buffer, sizeof(buffer), "%llu", value));
+    setlocale(LC_NUMERIC, "C");
+
+    // half prices with a few decimals, half any bit pattern
+    for(int i = 0; i < FORMAT_VALUES; ++i) {
+        if(i % 2) {
+            format_doubles[i] = (double)(rand() % 10000000)/1000;
+        } else {
+            uint64_t bits = (uint64_t)rand() << 42 ^ (uint64_t)rand() << 21 ^ (uint64_t)rand();
+            memcpy(&format_doubles[i], &bits, sizeof(double));
+            if(!isfinite(format_doubles[i])) format_doubles[i] = 0.5;
+        }
+    }
+    BENCH_FORMAT("rformat_double('_')", 10, format_doubles, rformat_double(value, '_', buffer, sizeof(buffer)));
+    BENCH_FORMAT("rformat_double(no separator)", 10, format_doubles, rformat_double(value, 0, buffer, sizeof(buffer)));
+    BENCH_FORMAT("snprintf(\"%.17g\")", 10, format_doubles, (size_t)snprintf(buffer, sizeof(buffer), "%.17g", value));
+    BENCH_FORMAT("snprintf(\"%.*g\") until strtod reads it back", 2, format_doubles, shortest_by_hand(value, buffer, sizeof(buffer)));
+}
+
+// ===========================
+// Batch scaling
+// ===========================
+#define BATCH_SIZE 2000000
+
+static char batch_text[BATCH_SIZE][28];
+static const char* batch_numbers[BATCH_SIZE];
+static long long batch_out[BATCH_SIZE];
+static uint8_t batch_status[BATCH_SIZE];
+
+static void bench_batch_scaling(void) {
+    srand(99);
+    for(int i = 0; i < BATCH_SIZE; ++i) {
+        long long value = ((long long)rand() << 31 | rand()) % 1000000000000LL - 500000000000LL;
+        // group the digits the way a feed would, with '_' every three digits
+        char plain[24];
+        int len = sprintf(plain, "%lld", value < 0 ? -value : value);
+        char* p = batch_text[i];
+        if(value < 0) *p++ = '-';
+        for(int j = 0; j < len; ++j) {
+            if(j && (len - j) % 3 == 0) *p++ = '_';
+            *p++ = plain[j];
+        }
+        *p = '\0';
+        batch_numbers[i] = batch_text[i];
+    }
+
+    long cores = sysconf(_SC_NPROCESSORS_ONLN);
+    if(cores < 1) cores = 1;
+    for(unsigned threads = 1; threads <= (unsigned)cores || threads <= 2; threads *= 2) {
+        struct measurement m;
+        char label[64];
+        measure_start(&m);
+        rparse_batch_longlong(batch_numbers, BATCH_SIZE, batch_out, batch_status, threads);
+        measure_stop(&m);
+        // the counters only see the calling thread
+        if(threads > 1) m.counted = 0;
+        snprintf(label, sizeof(label), "rparse_batch_longlong, %u thread(s)", threads);
+        report(label, &m, BATCH_SIZE, 0);
+    }
+}
+
+// ===========================
+// Delimited buffers
+// ===========================
+#define DELIMITED_FIELDS 1000000
+
+// One buffer of ';' separated integers grouped with '_', parsed in place by
+// rparse_delimited (and by each of its passes alone), then the way callers
+// split such buffers before: strtok on a copy, _rlonglong on every token.
+static void bench_delimited(void) {
+    char* text = malloc(DELIMITED_FIELDS*24);
+    char* copy = malloc(DELIMITED_FIELDS*24);
+    long long* values = malloc(DELIMITED_FIELDS*sizeof(*values));
+    long long* expected = malloc(DELIMITED_FIELDS*sizeof(*expected));
+    uint8_t* status = malloc(DELIMITED_FIELDS);
+    size_t* ends = malloc(DELIMITED_FIELDS*sizeof(*ends));
+    size_t length = 0;
+    srand(23);
+    for(int i = 0; i < DELIMITED_FIELDS; ++i) {
+        long long value = ((long long)rand() << 31 | rand()) % 1000000000000LL - 500000000000LL;
+        char plain[24];
+        int len = sprintf(plain, "%lld", value < 0 ? -value : value);
+        if(i) text[length++] = ';';
+        if(value < 0) text[length++] = '-';
+        for(int j = 0; j < len; ++j) {
+            if(j && (len - j) % 3 == 0) text[length++] = '_';
+            text[length++] = plain[j];
+        }
+        expected[i] = value;
+    }
+    text[length] = '\0';
+
+    const int rounds = 10;
+    struct measurement m;
+    long long fields = 0;
+    measure_start(&m);
+    for(int round = 0; round < rounds; ++round) fields = rparse_delimited(text, length, ';', RTYPE_LONGLONG, values, DELIMITED_FIELDS, status);
+    measure_stop(&m);
+    int same = fields == DELIMITED_FIELDS && !memcmp(values, expected, DELIMITED_FIELDS*sizeof(*values));
+    report(same ? "rparse_delimited" : "rparse_delimited (MISMATCH)", &m, (double)fields*rounds, (double)length*rounds);
+
+    measure_start(&m);
+    for(int round = 0; round < rounds; ++round) sink = rindex_fields(text, length, ';', ends, DELIMITED_FIELDS);
+    measure_stop(&m);
+    report("rindex_fields (first pass)", &m, (double)DELIMITED_FIELDS*rounds, (double)length*rounds);
+
+    measure_start(&m);
+    for(int round = 0; round < rounds; ++round) sink = rparse_fields(text, ends, DELIMITED_FIELDS, ';', RTYPE_LONGLONG, values, status);
+    measure_stop(&m);
+    report("rparse_fields (second pass)", &m, (double)DELIMITED_FIELDS*rounds, (double)length*rounds);
+
+    measure_start(&m);
+    for(int round = 0; round < rounds; ++round) {
+        memcpy(copy, text, length + 1);
+        size_t i = 0;
+        for(char* token = strtok(copy, ";"); token; token = strtok(NULL, ";")) values[i++] = _rlonglong(token);
+    }
+    measure_stop(&m);
+    same = !memcmp(values, expected, DELIMITED_FIELDS*sizeof(*values));
+    report(same ? "strtok + _rlonglong (on a copy)" : "strtok + _rlonglong (MISMATCH)", &m, (double)DELIMITED_FIELDS*rounds, (double)length*rounds);
+
+    free(text);
+    free(copy);
+    free(values);
+    free(expected);
+    free(status);
+    free(ends);
+}
+
+// ===========================
+// File ingestion
+// ===========================
+#define FILE_PATH "creadable_bench_file.tmp"
+#define FILE_BLOCK (1 << 20)
+
+// Writes `megabytes` of "id;amount;quantity" records built from one
+// randomly generated block repeated over and over.
+static size_t write_bench_file(size_t megabytes) {
+    static char block[FILE_BLOCK + 64];
+    size_t used = 0, block_rows = 0;
+    srand(7);
+    while(used < FILE_BLOCK) {
+        long long id = (long long)rand()*rand() % 10000000000LL;
+        int cents = rand() % 100000000;
+        used += sprintf(block + used, "%lld_%03lld_%03lld;%s%d,%03d.%02d;%d\n",
+                        id/1000000, id/1000 % 1000, id % 1000, rand() % 4 ? "" : "-",
+                        cents/100000, cents/100 % 1000, cents % 100, rand() % 1000);
+        ++block_rows;
+    }
+
+    FILE* file = fopen(FILE_PATH, "w");
+    if(!file) return 0;
+    for(size_t i = 0; i < megabytes; ++i) fwrite(block, 1, used, file);
+    fclose(file);
+    return block_rows*megabytes;
+}
+
+static void bench_file(size_t megabytes) {
+    size_t rows = write_bench_file(megabytes);
+    if(!rows) {
+        printf("cannot write %s\n", FILE_PATH);
+        return;
+    }
+    long long* ids = malloc(rows*sizeof(*ids));
+    double* amounts = malloc(rows*sizeof(*amounts));
+    int* quantities = malloc(rows*sizeof(*quantities));
+    unsigned char* errors = malloc((rows + 7)/8);
+    const struct rcolumn columns[] = {{RTYPE_LONGLONG, ids}, {RTYPE_DOUBLE, amounts}, {RTYPE_INT, quantities}};
+    FILE* file = NULL;
+    if(!ids || !amounts || !quantities || !errors) {
+        printf("skipped: cannot allocate the columns of %zu rows\n", rows);
+    } else if(!(file = fopen(FILE_PATH, "r"))) {
+        printf("skipped: cannot read %s\n", FILE_PATH);
+    } else {
+        fseek(file, 0, SEEK_END);
+        double bytes = ftell(file);
+        fclose(file);
+
+        long cores = sysconf(_SC_NPROCESSORS_ONLN);
+        if(cores < 1) cores = 1;
+        for(unsigned threads = 1; threads <= (unsigned)cores || threads <= 2; threads *= 2) {
+            struct measurement m;
+            char label[64];
+            measure_start(&m);
+            long long parsed = rparse_file(FILE_PATH, ';', columns, 3, rows, errors, threads);
+            measure_stop(&m);
+            if(threads > 1) m.counted = 0;
+            size_t failed = 0;
+            for(size_t i = 0; i < (rows + 7)/8; ++i) failed += errors[i] != 0;
+            snprintf(label, sizeof(label), "rparse_file, %u thread(s)%s", threads,
+                     parsed != (long long)rows || failed ? " (MISMATCH)" : "");
+            report(label, &m, (double)parsed, bytes);
+        }
+    }
+
+    free(ids);
+    free(amounts);
+    free(quantities);
+    free(errors);
+    remove(FILE_PATH);
+}
+
+// usage: creadable_bench [file megabytes] [--json results.json]
+int main(int argc, char** argv) {
+    size_t megabytes = 2048;
+    const char* json = NULL;
+    for(int i = 1; i < argc; ++i) {
+        if(!strcmp(argv[i], "--json") && i + 1 < argc) json = argv[++i];
+        else megabytes = strtoul(argv[i], NULL, 10);
+    }
+
+    counters_open();
+    printf("hardware counters: %s\n", counters_available ? "on" : "unavailable");
+    printf("kernels: %s (CREADABLE_SIMD caps them)\n", rsimd_level());
+
+    begin_section("PER-CALL-SITE CACHE (steady state)");
+    BENCH("_rint(\"1_000_000\")", _rint("1_000_000"));
+    BENCH("rint(1_000_000) cached", rint(1_000_000));
+    BENCH("_rulonglong(\"18,446,744,073,709,551,615\")", _rulonglong("18,446,744,073,709,551,615"));
+    BENCH("rulonglong(18,446,...) cached", rulonglong(18,446,744,073,709,551,615));
+    BENCH("_rdouble(\"-1_234.567_8\")", _rdouble("-1_234.567_8"));
+    BENCH("rdouble(-1_234.567_8) cached", rdouble(-1_234.567_8));
+
+    begin_section("INPUT SHAPES");
+    bench_shapes();
+
+    begin_section("ERROR PATH");
+    int value;
+    BENCH("rint_ex(\"12a34\")", rint_ex("12a34", &value).status);
+    rset_error_handler(NULL, NULL, 1);
+    BENCH("_rint(\"12a34\"), 1 message/s", _rint("12a34"));
+    rset_error_handler(NULL, NULL, CREADABLE_ERROR_RATE);
+
+    begin_section("FLOAT CORPUS (%d values)", CORPUS_SIZE);
+    build_float_corpus();
+    BENCH_CORPUS("_rdouble", 20, _rdouble(input));
+    BENCH_CORPUS("strtod", 20, strtod(input, NULL));
+    BENCH_CORPUS("_rfloat", 20, _rfloat(input));
+    BENCH_CORPUS("strtof", 20, strtof(input, NULL));
+
+    begin_section("RADIX LITERALS (%d values)", CORPUS_SIZE);
+    bench_radix();
+
+    begin_section("DIGIT RUNS");
+    bench_digit_runs();
+
+    begin_section("VALIDATION (%d values)", CORPUS_SIZE);
+    bench_validate();
+
+    begin_section("FIXED POINT (%d values)", CORPUS_SIZE);
+    bench_fixed();
+
+    begin_section("BIG INTEGERS");
+    bench_big();
+
+    begin_section("FORMATTING (%d values)", FORMAT_VALUES);
+    bench_format();
+
+    begin_section("BATCH SCALING (%d values, %ld core(s))", BATCH_SIZE, sysconf(_SC_NPROCESSORS_ONLN));
+    bench_batch_scaling();
+
+    begin_section("DELIMITED BUFFERS (%d values)", DELIMITED_FIELDS);
+    bench_delimited();
+
+    begin_section("FILE INGESTION (%zu MB)", megabytes);
+    bench_file(megabytes);
+
+    counters_close();
+    if(json) {
+        if(!write_json(json)) {
+            fprintf(stderr, "cannot write %s\n", json);
+            return 1;
+        }
+        printf("\nresults written to %s\n", json);
+    }
+    return 0;
+}
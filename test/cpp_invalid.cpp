@@ -0,0 +1,21 @@
+#include "../src/creadable.hpp"
+
+using namespace creadable::literals;
+
+// Every case below must fail to compile (see cpp_test in the Makefile),
+// with the error named after the #if.
+#if CASE == 1 // literal_overflows
+constexpr int value = "2_147_483_648"_rint;
+#elif CASE == 2 // literal_mixes_separators
+constexpr long value = creadable::parse<long>("1_000,000");
+#elif CASE == 3 // literal_has_invalid_symbol
+constexpr int value = "12a34"_rint;
+#elif CASE == 4 // literal_is_negative
+constexpr unsigned value = "-1"_ruint;
+#elif CASE == 5 // literal_is_not_an_integer
+constexpr short value = "1.5"_rshort;
+#elif CASE == 6 // literal_overflows
+constexpr double value = "1e400"_rdouble;
+#elif CASE == 7 // literal_underflows
+constexpr float value = "1e-50"_rfloat;
+#endif
@@ -0,0 +1,304 @@
+#include <bit>
+#include <climits>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+
+#include "../src/creadable.hpp"
+
+using namespace creadable::literals;
+
+// ===========================
+// Compile time
+// (every type of creadable.h, through parse<T>() and the literals)
+// ===========================
+static_assert("1_2_7"_rchar == 127);
+static_assert("0x41"_rchar == 'A');
+static_assert(creadable::parse<signed char>("-128") == SCHAR_MIN);
+static_assert("127"_rschar == SCHAR_MAX);
+static_assert("0b1111_1111"_ruchar == UCHAR_MAX);
+static_assert(creadable::parse<unsigned char>("  0") == 0);
+
+static_assert("-32,768"_rshort == SHRT_MIN);
+static_assert("0x7FFF"_rshort == SHRT_MAX);
+static_assert("65 535"_rushort == USHRT_MAX);
+
+static_assert(creadable::parse<int>("1_000_000") == 1000000);
+static_assert("-2_147_483_648"_rint == INT_MIN);
+static_assert("0o17_777_777_777"_rint == INT_MAX);
+static_assert("4,294,967,295"_ruint == UINT_MAX);
+
+static_assert("-1_234_567"_rlong == -1234567L);
+static_assert("-9_223_372_036_854_775_808"_rlonglong == LLONG_MIN);
+static_assert("0x7FFF_FFFF_FFFF_FFFF"_rlonglong == LLONG_MAX);
+static_assert("0o1_777_777_777_777_777_777_777"_rulong == ULONG_MAX);
+static_assert("18_446_744_073_709_551_615"_rulonglong == ULLONG_MAX);
+static_assert(creadable::parse<unsigned long long>("0xFFFF_FFFF_0000_0000") == 0xFFFFFFFF00000000ULL);
+
+static_assert("3.141_59"_rfloat == 3.14159f);
+static_assert("3.402_823_466e38"_rfloat == std::numeric_limits<float>::max());
+static_assert("1.4e-45"_rfloat == std::numeric_limits<float>::denorm_min());
+static_assert("16_777_217.0"_rfloat == 16777216.0f); // halfway, to even
+
+static_assert("0.1"_rdouble == 0.1);
+static_assert("6.022_140_76e+23"_rdouble == 6.02214076e23);
+static_assert("-1_234.567_8"_rdouble == -1234.5678);
+static_assert("1.797_693_134_862_315_7e308"_rdouble == std::numeric_limits<double>::max());
+static_assert("2.225_073_858_507_201_4e-308"_rdouble == std::numeric_limits<double>::min());
+static_assert("4.9e-324"_rdouble == std::numeric_limits<double>::denorm_min());
+static_assert("9_007_199_254_740_993.0"_rdouble == 9007199254740992.0);
+static_assert("9_007_199_254_740_993.000_000_000_000_000_000_001"_rdouble == 9007199254740994.0);
+static_assert("1.000_000_000_000_000_000_000_000_000_000_000_000_000_000_001"_rdouble == 1.0);
+static_assert(std::bit_cast<unsigned long long>("-0.0"_rdouble) == 0x8000000000000000ULL);
+
+static_assert("0.1"_rlongdouble == 0.1L);
+static_assert("-0.000_1"_rlongdouble == -0.0001L);
+static_assert("1.189_731_495_357_231_765e4932"_rlongdouble == std::numeric_limits<long double>::max());
+static_assert("3.645_199_531_882_474_602_5e-4951"_rlongdouble == std::numeric_limits<long double>::denorm_min());
+static_assert(creadable::parse<long double>("1.5e300") == 1.5e300L);
+
+#ifdef __SIZEOF_INT128__
+__extension__ typedef __int128 i128;
+__extension__ typedef unsigned __int128 u128;
+static_assert("170_141_183_460_469_231_731_687_303_715_884_105_727"_ri128 == i128(~u128(0) >> 1));
+static_assert("-170_141_183_460_469_231_731_687_303_715_884_105_728"_ri128 == -i128(~u128(0) >> 1) - 1);
+static_assert("340_282_366_920_938_463_463_374_607_431_768_211_455"_ru128 == ~u128(0));
+static_assert("0xFFFF_FFFF_FFFF_FFFF_FFFF_FFFF_FFFF_FFFF"_ru128 == ~u128(0));
+static_assert(creadable::parse<u128>("18_446_744_073_709_551_616") == u128(1) << 64);
+#endif
+
+// The runtime-capable variants, evaluated at compile time.
+template<class T>
+constexpr creadable::result parse_result(std::string_view text) {
+    T value{};
+    return creadable::parse(text, value);
+}
+
+template<class T>
+constexpr long offset_of(std::string_view text) {
+    return parse_result<T>(text).ptr - text.data();
+}
+
+static_assert(parse_result<int>("1_000_000").ec == RSTATUS_OK);
+static_assert(offset_of<int>("1_000_000") == 9);
+static_assert(parse_result<int>("").ec == RSTATUS_EMPTY);
+static_assert(parse_result<int>("12a34").ec == RSTATUS_INVALID_SYMBOL);
+static_assert(offset_of<int>("12a34") == 2);
+static_assert(parse_result<int>("1_000,000").ec == RSTATUS_SEPARATOR_MISMATCH);
+static_assert(offset_of<int>("1_000,000") == 5);
+static_assert(offset_of<int>("1 000\t000") == 5);
+static_assert(parse_result<int>("1-2").ec == RSTATUS_MISPLACED_SYMBOL);
+static_assert(parse_result<int>("+1").ec == RSTATUS_MISPLACED_SYMBOL);
+static_assert(parse_result<double>("1e").ec == RSTATUS_MISSING_EXPONENT);
+static_assert(offset_of<double>("1.5e") == 3);
+static_assert(parse_result<int>("2_147_483_648").ec == RSTATUS_OVERFLOW);
+static_assert(offset_of<int>("2_147_483_648") == 0);
+static_assert(parse_result<int>("-2_147_483_649").ec == RSTATUS_UNDERFLOW);
+static_assert(parse_result<unsigned>("-1").ec == RSTATUS_NEGATIVE_UNSIGNED);
+static_assert(parse_result<int>("1.5").ec == RSTATUS_FLOAT_TO_INTEGER);
+static_assert(parse_result<double>("5").ec == RSTATUS_INTEGER_TO_FLOAT);
+static_assert(parse_result<unsigned char>("0x1_00").ec == RSTATUS_OVERFLOW);
+static_assert(parse_result<int>("0x").ec == RSTATUS_MISPLACED_SYMBOL);
+static_assert(offset_of<int>("0b102") == 4);
+static_assert(parse_result<int>("42  ").ec == RSTATUS_OK);
+
+// out of range floats are accepted at run time, like in C
+static_assert(parse_result<double>("1e400").ec == RSTATUS_OK);
+static_assert(parse_result<float>("-1e-60").ec == RSTATUS_OK);
+static_assert([] {
+    double value = 0;
+    creadable::parse("1e400", value);
+    return value == std::numeric_limits<double>::infinity();
+}());
+
+// from_chars() reads a prefix and leaves the value alone on error.
+template<class T>
+struct prefix {
+    T value;
+    long length;
+    enum rstatus status;
+};
+
+template<class T>
+constexpr prefix<T> read_prefix(std::string_view text, T initial = T()) {
+    prefix<T> ret{initial, 0, RSTATUS_OK};
+    creadable::result result = creadable::from_chars(text.data(), text.data() + text.size(), ret.value);
+    ret.length = result.ptr - text.data();
+    ret.status = result.ec;
+    return ret;
+}
+
+static_assert(read_prefix<int>("42 apples").value == 42);
+static_assert(read_prefix<int>("42 apples").length == 2);
+static_assert(read_prefix<int>("  1_000_").length == 7);
+static_assert(read_prefix<int>("1 000 apples").value == 1000);
+static_assert(read_prefix<int>("1 000 apples").length == 5);
+static_assert(read_prefix<double>("2.5e3x").value == 2500.0);
+static_assert(read_prefix<double>("2.5ex").length == 3);
+static_assert(read_prefix<int>("0x1Fg").value == 31);
+static_assert(read_prefix<int>("0xg").value == 0);
+static_assert(read_prefix<int>("0xg").length == 1);
+static_assert(read_prefix<int>("apples", 7).value == 7);
+static_assert(read_prefix<int>("apples", 7).status == RSTATUS_EMPTY);
+static_assert(read_prefix<int>("apples", 7).length == 0);
+static_assert(read_prefix<signed char>("300,", 7).status == RSTATUS_OVERFLOW);
+static_assert(read_prefix<signed char>("300,", 7).value == 7);
+static_assert(read_prefix<signed char>("300,", 7).length == 3);
+
+static_assert(static_cast<bool>(creadable::result{nullptr, RSTATUS_OK}));
+static_assert(!creadable::result{nullptr, RSTATUS_EMPTY});
+
+// ===========================
+// Test framework
+// ===========================
+static int total_tests = 0;
+static int passed_tests = 0;
+static int failed_tests = 0;
+
+#define ASSERT_TRUE(condition, label) do { \
+    total_tests++; \
+    if(condition) { \
+        passed_tests++; \
+        printf("[PASS] %s\n", label); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s\n", label); \
+    } \
+} while(0)
+
+static void drop_error(enum rstatus status, const char* message, void* context) {
+    (void)status, (void)message, (void)context;
+}
+
+template<class T>
+static bool same(T a, T b) {
+    if constexpr(creadable::detail::floating<T>) {
+        if(std::isnan(a) || std::isnan(b)) return std::isnan(a) && std::isnan(b);
+        return a == b && std::signbit(a) == std::signbit(b);
+    }
+    else {
+        return a == b;
+    }
+}
+
+// ===========================
+// Runtime: same answers as the C library
+// ===========================
+static std::string corpus_entry(unsigned long long& seed, bool floating) {
+    static const char alphabet[] = "0123456789000111999_,_ .e-+xXobBaF\t5";
+    seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+    std::string text;
+    unsigned length = (unsigned)(seed >> 59) + 1;
+    if(!floating) {
+        for(unsigned i = 0; i < length; ++i) {
+            seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+            text += alphabet[(seed >> 33) % (sizeof(alphabet) - 1)];
+        }
+        return text;
+    }
+
+    // well formed floating point numbers over the whole range
+    if(seed >> 63) text += '-';
+    for(unsigned i = 0; i < length; ++i) {
+        seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+        text += (char)('0' + (seed >> 33) % 10);
+        if(i == length/2) text += '.';
+    }
+    seed = seed*6364136223846793005ULL + 1442695040888963407ULL;
+    if(seed >> 62) {
+        text += 'e';
+        text += std::to_string((long)((seed >> 33) % 10000) - 5000);
+    }
+    return text;
+}
+
+#define COMPARE(name, type) \
+    static void compare_##name(const char* label) { \
+        unsigned long long seed = 42; \
+        long mismatches = 0; \
+        std::string first_mismatch; \
+        for(int i = 0; i < 40000; ++i) { \
+            std::string text = corpus_entry(seed, i % 2); \
+            type expected = 0, value = 0; \
+            struct rresult c = r##name##_ex(text.c_str(), &expected); \
+            creadable::result cpp = creadable::parse(text, value); \
+            size_t offset = c.status ? c.offset : text.size(); \
+            bool match = c.status == cpp.ec && offset == (size_t)(cpp.ptr - text.data()) && same(expected, value); \
+            const char* end; \
+            expected = _r##name##_n(text.c_str(), text.size(), &end); \
+            value = 0; \
+            cpp = creadable::from_chars(text.data(), text.data() + text.size(), value); \
+            match = match && end == cpp.ptr && same(expected, value); \
+            if(!match && !mismatches++) first_mismatch = text; \
+        } \
+        char message[256]; \
+        snprintf(message, sizeof(message), "%s agrees with the C library%s%s%s", label, \
+                 mismatches ? " (first mismatch: \"" : "", first_mismatch.c_str(), mismatches ? "\")" : ""); \
+        ASSERT_TRUE(!mismatches, message); \
+    }
+
+COMPARE(char, char)
+COMPARE(schar, signed char)
+COMPARE(uchar, unsigned char)
+
+COMPARE(short, short)
+COMPARE(ushort, unsigned short)
+
+COMPARE(int, int)
+COMPARE(uint, unsigned int)
+
+COMPARE(long, long)
+COMPARE(longlong, long long)
+COMPARE(ulong, unsigned long)
+COMPARE(ulonglong, unsigned long long)
+
+COMPARE(float, float)
+
+COMPARE(double, double)
+COMPARE(longdouble, long double)
+
+#ifdef __SIZEOF_INT128__
+COMPARE(i128, i128)
+COMPARE(u128, u128)
+#endif
+
+int main(void) {
+    rset_error_handler(drop_error, NULL, 0);
+
+    printf("==== COMPILE TIME ====\n");
+    // a literal is a constant: no parser runs for it
+    constexpr int million = "1_000_000"_rint;
+    constexpr double avogadro = "6.022_140_76e+23"_rdouble;
+    ASSERT_TRUE(million == 1000000 && avogadro == 6.02214076e23, "literals are constants");
+
+    printf("\n==== RUNTIME ====\n");
+    std::string dynamic = "-1_234.5";
+    double value = 0;
+    ASSERT_TRUE(creadable::parse(dynamic, value) && value == -1234.5, "parse() reads a runtime string");
+    compare_char("char");
+    compare_schar("signed char");
+    compare_uchar("unsigned char");
+    compare_short("short");
+    compare_ushort("unsigned short");
+    compare_int("int");
+    compare_uint("unsigned int");
+    compare_long("long");
+    compare_longlong("long long");
+    compare_ulong("unsigned long");
+    compare_ulonglong("unsigned long long");
+    compare_float("float");
+    compare_double("double");
+    compare_longdouble("long double");
+#ifdef __SIZEOF_INT128__
+    compare_i128("__int128");
+    compare_u128("unsigned __int128");
+#endif
+
+    printf("\n==== SUMMARY ====\n");
+    printf("Total: %d | Passed: %d | Failed: %d\n",
+           total_tests, passed_tests, failed_tests);
+
+    return (failed_tests == 0) ? 0 : 1;
+}
@@ -0,0 +1,10 @@
+// Every call site below must be rejected by creadable_gen (see gen_test in
+// the Makefile), each with its own file:line:column.
+int invalid(void) {
+    return rint(12a34)
+        + rchar(128)
+        + ruint(-1)
+        + rint(1.5);
+}
+double not_an_integer(void) { return rdouble(5); }
+double out_of_range(void) { return rdouble(1e400) + rfloat(1.0e39); }
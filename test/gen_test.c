@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <limits.h>
+#include <float.h>
+#include <string.h>
+
+#include "creadable.h"
+
+// ===========================
+// Generated call sites
+// (built with -include gen_test.rgen.h, the Makefile checks that none of
+// these call into the parser)
+// ===========================
+#define TIMEOUT_MS rint(30_000)
+#define SCALED(value) rint(value)
+
+static const unsigned long long mask = rulonglong(0xFFFF_FFFF_0000_0000);
+static const double rate = rdouble(6.022_140_76e+23);
+
+char gen_char(void) { return rchar(1_2_7); }
+signed char gen_schar(void) { return rschar(-128); }
+unsigned char gen_uchar(void) { return ruchar(0b1010_0101); }
+short gen_short(void) { return rshort(-32,768); }
+unsigned short gen_ushort(void) { return rushort(65 535); }
+int gen_int(void) { return rint( 1_000_000_000 ); }
+int gen_int_min(void) { return rint(-2,147,483,648); }
+int gen_timeout(void) { return TIMEOUT_MS; }
+unsigned int gen_uint(void) { return ruint(4_294_967_295); }
+long gen_long(void) { return rlong(-1_234_567); }
+long long gen_longlong(void) { return rlonglong(-9_223_372_036_854_775_808); }
+unsigned long gen_ulong(void) {
+    return rulong(
+        18,446,744,073,709,551,615 /* spans lines */
+    );
+}
+unsigned long long gen_mask(void) { return mask; }
+float gen_float(void) { return rfloat(3.141_59); }
+double gen_double(void) { return rdouble(-1_234.567_8) + rdouble(0.1); }
+double gen_rate(void) { return rate; }
+long double gen_longdouble(void) { return rlongdouble(0.000_1); }
+#ifdef __SIZEOF_INT128__
+unsigned __int128 gen_u128(void) { return ru128(340_282_366_920_938_463_463_374_607_431_768_211_455); }
+__int128 gen_i128(void) { return ri128(-170_141_183_460_469_231_731_687_303_715_884_105_728); }
+#endif
+
+// not call sites: comments like rint(12a34), strings and member names
+struct settings { int (*rint)(int); };
+static const char* note = "rint(12a34)";
+
+// ===========================
+// Test framework
+// ===========================
+static int total_tests = 0;
+static int passed_tests = 0;
+static int failed_tests = 0;
+
+#define ASSERT_GENERATED(fn, expected) do { \
+    total_tests++; \
+    if(fn() == (expected)) { \
+        passed_tests++; \
+        printf("[PASS] %s() is %s\n", #fn, #expected); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s() does not equal %s\n", #fn, #expected); \
+    } \
+} while(0)
+
+int main(void) {
+    printf("==== GENERATED CONSTANTS ====\n");
+    ASSERT_GENERATED(gen_char, 127);
+    ASSERT_GENERATED(gen_schar, SCHAR_MIN);
+    ASSERT_GENERATED(gen_uchar, 0xA5);
+    ASSERT_GENERATED(gen_short, SHRT_MIN);
+    ASSERT_GENERATED(gen_ushort, USHRT_MAX);
+    ASSERT_GENERATED(gen_int, 1000000000);
+    ASSERT_GENERATED(gen_int_min, INT_MIN);
+    ASSERT_GENERATED(gen_timeout, 30000);
+    ASSERT_GENERATED(gen_uint, UINT_MAX);
+    ASSERT_GENERATED(gen_long, -1234567L);
+    ASSERT_GENERATED(gen_longlong, LLONG_MIN);
+    ASSERT_GENERATED(gen_ulong, ULONG_MAX);
+    ASSERT_GENERATED(gen_mask, 0xFFFFFFFF00000000ULL);
+    ASSERT_GENERATED(gen_float, 3.14159f);
+    ASSERT_GENERATED(gen_double, -1234.5678 + 0.1);
+    ASSERT_GENERATED(gen_rate, 6.02214076e23);
+    ASSERT_GENERATED(gen_longdouble, 0.0001L);
+#ifdef __SIZEOF_INT128__
+    ASSERT_GENERATED(gen_u128, ~(unsigned __int128)0);
+    ASSERT_GENERATED(gen_i128, -(__int128)(~(unsigned __int128)0 >> 1) - 1);
+#endif
+
+    // literals the generator has not seen still reach the runtime parser
+    char dynamic[] = "1_234";
+    total_tests++;
+    if(SCALED(1_234) == 1234 && _rint(dynamic) == 1234 && !strcmp(note, "rint(12a34)")) {
+        passed_tests++;
+        printf("[PASS] unseen literals fall back to the runtime parser\n");
+    } else {
+        failed_tests++;
+        printf("[FAIL] unseen literals fall back to the runtime parser\n");
+    }
+
+    printf("\n==== SUMMARY ====\n");
+    printf("Total: %d | Passed: %d | Failed: %d\n",
+           total_tests, passed_tests, failed_tests);
+
+    return (failed_tests == 0) ? 0 : 1;
+}
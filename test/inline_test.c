@@ -0,0 +1,73 @@
+#include <stdio.h>
+#include <limits.h>
+#include <float.h>
+
+#define CREADABLE_INLINE
+#include "../src/creadable.h"
+
+// ===========================
+// Folded call sites
+// (the Makefile checks that none of these call into the parser)
+// ===========================
+char fold_char(void) { return rchar(1_2_7); }
+signed char fold_schar(void) { return rschar(-128); }
+unsigned char fold_uchar(void) { return ruchar(2_5_5); }
+short fold_short(void) { return rshort(-32,768); }
+unsigned short fold_ushort(void) { return rushort(65_535); }
+int fold_int(void) { return rint(1_000_000_000); }
+int fold_int_min(void) { return rint(-2,147,483,648); }
+unsigned int fold_uint(void) { return ruint(4_294_967_295); }
+long fold_long(void) { return rlong(-1_234_567); }
+long long fold_longlong(void) { return rlonglong(9_223_372_036_854_775_807); }
+unsigned long fold_ulong(void) { return rulong(18,446,744,073,709,551,615); }
+unsigned long long fold_ulonglong(void) { return rulonglong(18_446_744_073_709_551_615); }
+float fold_float(void) { return rfloat(3.141_59); }
+double fold_double(void) { return rdouble(-1_234.567_8); }
+long double fold_longdouble(void) { return rlongdouble(0.000_1); }
+unsigned long long fold_rparse(void) { unsigned long long value; return rparse(18,446,744,073,709,551,615, &value); }
+double fold_rparse_double(void) { double value; return rparse(-1_234.567_8, &value); }
+
+// ===========================
+// Test framework
+// ===========================
+static int total_tests = 0;
+static int passed_tests = 0;
+static int failed_tests = 0;
+
+#define ASSERT_FOLDED(fn, expected) do { \
+    total_tests++; \
+    if(fn() == (expected)) { \
+        passed_tests++; \
+        printf("[PASS] %s() folded to %s\n", #fn, #expected); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s() does not equal %s\n", #fn, #expected); \
+    } \
+} while(0)
+
+int main(void) {
+    printf("==== FOLDED LITERALS ====\n");
+    ASSERT_FOLDED(fold_char, 127);
+    ASSERT_FOLDED(fold_schar, SCHAR_MIN);
+    ASSERT_FOLDED(fold_uchar, UCHAR_MAX);
+    ASSERT_FOLDED(fold_short, SHRT_MIN);
+    ASSERT_FOLDED(fold_ushort, USHRT_MAX);
+    ASSERT_FOLDED(fold_int, 1000000000);
+    ASSERT_FOLDED(fold_int_min, INT_MIN);
+    ASSERT_FOLDED(fold_uint, UINT_MAX);
+    ASSERT_FOLDED(fold_long, -1234567L);
+    ASSERT_FOLDED(fold_longlong, LLONG_MAX);
+    ASSERT_FOLDED(fold_ulong, ULONG_MAX);
+    ASSERT_FOLDED(fold_ulonglong, ULLONG_MAX);
+    ASSERT_FOLDED(fold_float, 3.14159f);
+    ASSERT_FOLDED(fold_double, -1234.5678);
+    ASSERT_FOLDED(fold_longdouble, 0.0001L);
+    ASSERT_FOLDED(fold_rparse, ULLONG_MAX);
+    ASSERT_FOLDED(fold_rparse_double, -1234.5678);
+
+    printf("\n==== SUMMARY ====\n");
+    printf("Total: %d | Passed: %d | Failed: %d\n",
+           total_tests, passed_tests, failed_tests);
+
+    return (failed_tests == 0) ? 0 : 1;
+}
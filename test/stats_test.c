@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+
+#include "../src/creadable.h"
+
+// Built together with creadable.c with CREADABLE_STATS and
+// CREADABLE_STATS_CYCLES defined (see the stats_test target).
+
+// ===========================
+// Test framework
+// ===========================
+static int total_tests = 0;
+static int passed_tests = 0;
+static int failed_tests = 0;
+
+#define ASSERT_TRUE(condition, label) do { \
+    total_tests++; \
+    if(condition) { \
+        passed_tests++; \
+        printf("[PASS] %s\n", label); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s\n", label); \
+    } \
+} while(0)
+
+static unsigned long long total_cycles(const struct rstats_type* type) {
+    unsigned long long total = 0;
+    for(int b = 0; b < RSTATS_BUCKETS; ++b) total += type->cycles[b];
+    return total;
+}
+
+#define THREADS 4
+#define PER_THREAD 1000
+
+static void* parse_in_thread(void* arg) {
+    (void)arg;
+    for(int i = 0; i < PER_THREAD; ++i) _rlong("-1_000");
+    return NULL;
+}
+
+static void drop_error(enum rstatus status, const char* message, void* context) {
+    (void)status;
+    (void)message;
+    (void)context;
+}
+
+int main(void) {
+    struct rstats stats;
+    rset_error_handler(drop_error, NULL, 0);
+
+    printf("==== COUNTERS ====\n");
+    rstats_reset();
+    _rint("1_000");
+    _rint("12a34");
+    _rint("2_147_483_648");
+    _rint("1,000_000");
+    _rint("1.5");
+    int value;
+    rint_ex("-7", &value);
+    _rdouble("3.25");
+    rstats_snapshot(&stats);
+
+    const struct rstats_type* ints = &stats.types[RTYPE_INT];
+    ASSERT_TRUE(ints->calls == 6, "int calls counted through every API");
+    ASSERT_TRUE(ints->bytes == 5 + 5 + 13 + 9 + 3 + 2, "int bytes counted");
+    ASSERT_TRUE(ints->statuses[RSTATUS_OK] == 2, "int successes counted");
+    ASSERT_TRUE(ints->statuses[RSTATUS_INVALID_SYMBOL] == 1, "invalid symbol counted");
+    ASSERT_TRUE(ints->statuses[RSTATUS_OVERFLOW] == 1, "overflow counted");
+    ASSERT_TRUE(ints->statuses[RSTATUS_SEPARATOR_MISMATCH] == 1, "separator mismatch counted");
+    ASSERT_TRUE(ints->statuses[RSTATUS_FLOAT_TO_INTEGER] == 1, "type mismatch counted");
+    ASSERT_TRUE(total_cycles(ints) == 6, "every int call timed");
+    ASSERT_TRUE(stats.types[RTYPE_DOUBLE].calls == 1 && stats.types[RTYPE_FLOAT].calls == 0, "types kept apart");
+
+    printf("\n==== BATCH ====\n");
+    rstats_reset();
+    const char* numbers[] = {"1", "2", "x"};
+    short shorts[3];
+    rparse_batch_short(numbers, 3, shorts, NULL, 2);
+    rstats_snapshot(&stats);
+    ASSERT_TRUE(stats.types[RTYPE_SHORT].calls == 3 && stats.types[RTYPE_SHORT].statuses[RSTATUS_INVALID_SYMBOL] == 1,
+                "batch elements counted across worker threads");
+
+    printf("\n==== THREADS ====\n");
+    rstats_reset();
+    pthread_t threads[THREADS];
+    for(int t = 0; t < THREADS; ++t) pthread_create(&threads[t], NULL, parse_in_thread, NULL);
+    for(int t = 0; t < THREADS; ++t) pthread_join(threads[t], NULL);
+    rstats_snapshot(&stats);
+    ASSERT_TRUE(stats.types[RTYPE_LONG].calls == THREADS*PER_THREAD, "shards of exited threads kept");
+    ASSERT_TRUE(stats.types[RTYPE_INT].calls == 0, "reset hides earlier calls");
+
+    printf("\n==== DUMP ====\n");
+    char buffer[4096];
+    FILE* out = fmemopen(buffer, sizeof(buffer), "w");
+    rstats_dump(out, &stats, RSTATS_TEXT);
+    fclose(out);
+    ASSERT_TRUE(strstr(buffer, "long: 4000 calls, 24000 bytes, 0 errors") != NULL, "text dump");
+
+    rstats_reset();
+    _ruint("-1");
+    rstats_snapshot(&stats);
+    out = fmemopen(buffer, sizeof(buffer), "w");
+    rstats_dump(out, &stats, RSTATS_JSON);
+    fclose(out);
+    const char* expected = "{\"unsigned int\": {\"calls\": 1, \"bytes\": 2, \"statuses\": {\"negative_unsigned\": 1}, \"cycles\": [";
+    ASSERT_TRUE(!strncmp(buffer, expected, strlen(expected)), "JSON dump");
+
+    printf("\n==== SUMMARY ====\n");
+    printf("Total: %d | Passed: %d | Failed: %d\n",
+           total_tests, passed_tests, failed_tests);
+
+    return (failed_tests == 0) ? 0 : 1;
+}
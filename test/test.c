@@ -3,6 +3,10 @@
 #include <limits.h>
 #include <float.h>
 #include <math.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include "../src/creadable.h"
 
 // ===========================
@@ -44,7 +48,7 @@ static int failed_tests = 0;
         printf("[PASS] %s(\"%s\") = %ld\n", #fn, input, result); \
     } else { \
         failed_tests++; \
-        printf("[FAIL] %s(\"%s\") = %ld (expected %ld)\n", #fn, input, result, expected); \
+        printf("[FAIL] %s(\"%s\") = %ld (expected %ld)\n", #fn, input, result, (long)(expected)); \
     } \
 } while(0)
 
@@ -119,11 +123,292 @@ static int failed_tests = 0;
         printf("[FAIL] %s(\"%s\") = %Lf (expected ~%Lf)\n", #fn, input, result, expected); \
     } \
 } while(0)
+#define ASSERT_EXACT_FLOAT(fn, input, expected) do { \
+    total_tests++; \
+    float result = fn(input); \
+    if(result == expected && signbit(result) == signbit(expected)) { \
+        passed_tests++; \
+        printf("[PASS] %s(\"%s\") = %.9g\n", #fn, input, result); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s(\"%s\") = %.9g (expected %.9g)\n", #fn, input, result, expected); \
+    } \
+} while(0)
 
+#define ASSERT_EXACT_DOUBLE(fn, input, expected) do { \
+    total_tests++; \
+    double result = fn(input); \
+    if(result == expected && signbit(result) == signbit(expected)) { \
+        passed_tests++; \
+        printf("[PASS] %s(\"%s\") = %.17g\n", #fn, input, result); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s(\"%s\") = %.17g (expected %.17g)\n", #fn, input, result, expected); \
+    } \
+} while(0)
+
+// rparse() must both store the value and evaluate to it
+#define ASSERT_RPARSE(var, expected, ...) do { \
+    total_tests++; \
+    if(rparse(__VA_ARGS__, &var) == (expected) && var == (expected)) { \
+        passed_tests++; \
+        printf("[PASS] rparse(%s, &%s)\n", #__VA_ARGS__, #var); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] rparse(%s, &%s)\n", #__VA_ARGS__, #var); \
+    } \
+} while(0)
+
+#define ASSERT_RESULT(call, var, expected, expected_status, expected_offset) do { \
+    total_tests++; \
+    struct rresult result = call; \
+    if(result.status == (expected_status) && result.offset == (expected_offset) && (var) == (expected)) { \
+        passed_tests++; \
+        printf("[PASS] %s\n", #call); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s: status %d at offset %zu\n", #call, result.status, result.offset); \
+    } \
+} while(0)
+
+// parses the first length bytes of input and checks the value and how many
+// bytes were consumed
+#define ASSERT_PREFIX(fn, input, length, expected, expected_consumed) do { \
+    total_tests++; \
+    const char* end = NULL; \
+    if(fn(input, length, &end) == (expected) && end - (input) == (expected_consumed)) { \
+        passed_tests++; \
+        printf("[PASS] %s(\"%.*s\", %d) consumed %d\n", #fn, (int)(length), input, (int)(length), (int)(expected_consumed)); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s(\"%.*s\", %d) consumed %d\n", #fn, (int)(length), input, (int)(length), (int)(end - (input))); \
+    } \
+} while(0)
+
+#define ASSERT_VALIDATE(input, expected_status, expected_offset) do { \
+    total_tests++; \
+    struct rresult result = rvalidate(input, strlen(input)); \
+    if(result.status == (expected_status) && result.offset == (expected_offset)) { \
+        passed_tests++; \
+        printf("[PASS] rvalidate(\"%s\")\n", input); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] rvalidate(\"%s\"): status %d at offset %zu\n", input, result.status, result.offset); \
+    } \
+} while(0)
+
+#define ASSERT_FORMAT(call, buffer, expected) do { \
+    total_tests++; \
+    size_t length = call; \
+    if(!strcmp(buffer, expected) && length == strlen(expected)) { \
+        passed_tests++; \
+        printf("[PASS] %s = \"%s\"\n", #call, expected); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s = \"%s\", expected \"%s\"\n", #call, buffer, expected); \
+    } \
+} while(0)
+
+#define ASSERT_NO_ALLOC(call) do { \
+    total_tests++; \
+    int before = allocations; \
+    (void)(call); \
+    if(allocations == before) { \
+        passed_tests++; \
+        printf("[PASS] %s made no allocation\n", #call); \
+    } else { \
+        failed_tests++; \
+        printf("[FAIL] %s made %d allocation(s)\n", #call, allocations - before); \
+    } \
+} while(0)
+
+// ===========================
+// Allocator interposition
+// (the test binary is linked with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc)
+// ===========================
+static int allocations = 0;
+
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void* __real_realloc(void* ptr, size_t size);
+
+void* __wrap_malloc(size_t size) {
+    allocations++;
+    return __real_malloc(size);
+}
+void* __wrap_calloc(size_t count, size_t size) {
+    allocations++;
+    return __real_calloc(count, size);
+}
+void* __wrap_realloc(void* ptr, size_t size) {
+    allocations++;
+    return __real_realloc(ptr, size);
+}
 
 // ===========================
 // Main tests
 // ===========================
+struct captured_errors {
+    int count;
+    enum rstatus last;
+    char first_message[128];
+};
+
+static void capture_error(enum rstatus status, const char* message, void* context) {
+    struct captured_errors* captured = context;
+    if(!captured->count++) snprintf(captured->first_message, sizeof(captured->first_message), "%s", message);
+    captured->last = status;
+}
+
+// what an rstream hands back, each value kept as the bytes of its type in
+// storage aligned for any of them
+union streamed_value {
+    long long integer;
+    unsigned long long natural;
+    double floating;
+    long double extended;
+    unsigned char bytes[sizeof(long double)];
+};
+
+struct streamed {
+    size_t count;
+    size_t size;
+    int out_of_order;
+    union streamed_value values[64];
+    struct rresult results[64];
+};
+
+static void collect_number(size_t index, const void* value, struct rresult result, void* context) {
+    struct streamed* streamed = context;
+    if(index != streamed->count) streamed->out_of_order = 1;
+    if(streamed->count < 64) {
+        memset(streamed->values[streamed->count].bytes, 0, sizeof(streamed->values[0]));
+        memcpy(streamed->values[streamed->count].bytes, value, streamed->size);
+        streamed->results[streamed->count] = result;
+    }
+    streamed->count++;
+}
+
+// Parses each field of input with parse, as the r*_ex() function would,
+// into expected, and returns how many there are.
+typedef struct rresult (*field_parser)(const char* field, void* out);
+
+static size_t expect_fields(const char* input, char delimiter, field_parser parse, size_t size, struct streamed* expected) {
+    char field[256];
+    expected->count = 0;
+    expected->size = size;
+    for(const char* p = input;; ++p) {
+        const char* end = strchr(p, delimiter);
+        if(!end) end = p + strlen(p);
+        size_t length = (size_t)(end - p);
+        if(length || *end) {
+            memcpy(field, p, length);
+            field[length] = '\0';
+            if(delimiter == '\n' && length && field[length - 1] == '\r') field[length - 1] = '\0';
+            memset(expected->values[expected->count].bytes, 0, sizeof(expected->values[0]));
+            expected->results[expected->count] = parse(field, &expected->values[expected->count]);
+            expected->count++;
+        }
+        if(!*end) break;
+        p = end;
+    }
+    return expected->count;
+}
+
+// Feeds input in two chunks cut at every possible point (and byte by byte)
+// and checks that the stream completes the same numbers each time.
+static int stream_splits(const char* input, enum rtype type, char delimiter, const struct streamed* expected) {
+    size_t length = strlen(input);
+    for(size_t cut = 0; cut <= length + 1; ++cut) {
+        struct streamed streamed = {0};
+        streamed.size = expected->size;
+        rstream_t stream;
+        if(rstream_init(&stream, type, delimiter, collect_number, &streamed)) return 0;
+        if(cut <= length) {
+            rstream_feed(&stream, input, cut);
+            rstream_feed(&stream, input + cut, length - cut);
+        } else {
+            for(size_t i = 0; i < length; ++i) rstream_feed(&stream, input + i, 1);
+        }
+        rstream_finish(&stream);
+
+        if(streamed.count != expected->count || streamed.out_of_order) return 0;
+        for(size_t i = 0; i < expected->count; ++i) {
+            if(memcmp(streamed.values[i].bytes, expected->values[i].bytes, expected->size) ||
+               streamed.results[i].status != expected->results[i].status ||
+               streamed.results[i].offset != expected->results[i].offset) {
+                return 0;
+            }
+        }
+    }
+    return 1;
+}
+
+static struct rresult field_ulonglong(const char* field, void* out) { return rulonglong_ex(field, out); }
+static struct rresult field_int(const char* field, void* out) { return rint_ex(field, out); }
+static struct rresult field_schar(const char* field, void* out) { return rschar_ex(field, out); }
+static struct rresult field_double(const char* field, void* out) { return rdouble_ex(field, out); }
+static struct rresult field_float(const char* field, void* out) { return rfloat_ex(field, out); }
+
+// q + r/divisor rounded the given way, as the magnitude of a fixed-point
+// value: the reference the rdecimal_*() results are checked against.
+static unsigned long long round_reference(unsigned long long q, unsigned long long r, unsigned long long divisor, int negative, enum rrounding rounding) {
+    if(!r) return q;
+    switch(rounding) {
+    case RROUND_HALF_EVEN: return q + (2*r > divisor || (2*r == divisor && q % 2));
+    case RROUND_HALF_AWAY: return q + (2*r >= divisor);
+    case RROUND_FLOOR: return q + (negative != 0);
+    case RROUND_CEILING: return q + !negative;
+    default: return q;
+    }
+}
+
+// The decimal digits of count limbs (used up on the way) by schoolbook
+// division, nine digits at a time: the reference rbig_ex() is checked
+// against. Returns how many digits it wrote.
+static size_t limbs_to_decimal(uint64_t* limbs, size_t count, char* out) {
+    size_t length = 0;
+    while(count && !limbs[count - 1]) --count;
+    while(count) {
+        uint64_t remainder = 0;
+        for(size_t i = count; i--;) {
+            uint64_t high = remainder << 32 | limbs[i] >> 32;
+            uint64_t low = (high % 1000000000) << 32 | (limbs[i] & 0xFFFFFFFF);
+            limbs[i] = (high / 1000000000) << 32 | low / 1000000000;
+            remainder = low % 1000000000;
+        }
+        while(count && !limbs[count - 1]) --count;
+        for(int d = 0; d < 9; ++d) {
+            out[length++] = (char)('0' + remainder % 10);
+            remainder /= 10;
+        }
+    }
+    while(length > 1 && out[length - 1] == '0') --length;
+    if(!length) out[length++] = '0';
+    for(size_t i = 0; i < length/2; ++i) {
+        char swap = out[i];
+        out[i] = out[length - 1 - i];
+        out[length - 1 - i] = swap;
+    }
+    return length;
+}
+
+// Digits of a formatted number from the first nonzero one to the last
+// nonzero one before any exponent.
+static int significant_digits(const char* text) {
+    int digits = 0, zeros = 0;
+    for(; *text && *text != 'e'; ++text) {
+        if(*text < '0' || *text > '9') continue;
+        if(*text == '0') {
+            if(digits) ++zeros;
+        } else {
+            digits += zeros + 1;
+            zeros = 0;
+        }
+    }
+    return digits;
+}
+
 int main(void) {
     char buf[64];
 
@@ -165,14 +450,14 @@ int main(void) {
     ASSERT_EQ_ULLONG(_rulonglong, buf, ULLONG_MAX);
 
     printf("\n==== FLOAT BOUNDARIES ====\n");
-    sprintf(buf, "%.6e", FLT_MAX);
+    sprintf(buf, "%.8e", FLT_MAX);
     ASSERT_EQ_FLOAT(_rfloat, buf, FLT_MAX);
-    sprintf(buf, "%.6e", FLT_MIN);
+    sprintf(buf, "%.8e", FLT_MIN);
     ASSERT_EQ_FLOAT(_rfloat, buf, FLT_MIN);
 
-    sprintf(buf, "%.15e", DBL_MAX);
+    sprintf(buf, "%.16e", DBL_MAX);
     ASSERT_EQ_DOUBLE(_rdouble, buf, DBL_MAX);
-    sprintf(buf, "%.15e", DBL_MIN);
+    sprintf(buf, "%.16e", DBL_MIN);
     ASSERT_EQ_DOUBLE(_rdouble, buf, DBL_MIN);
 
     printf("\n==== ZERO HANDLING ====\n");
@@ -203,6 +488,1444 @@ int main(void) {
     ASSERT_EQ_UINT(_ruint, "999999999999999", 0);
     ASSERT_EQ_LONG(_rlong, "-99999999999999999999999", 0);
 
+    printf("\n==== SCIENTIFIC NOTATION ====\n");
+    ASSERT_EXACT_DOUBLE(_rdouble, "6.022_140_76e+23", 6.02214076e23);
+    ASSERT_EXACT_DOUBLE(_rdouble, "-1.5E-3", -1.5e-3);
+    ASSERT_EXACT_DOUBLE(_rdouble, "1e5", 1e5);
+    ASSERT_EXACT_DOUBLE(_rdouble, "1_0.5e1_0", 10.5e10);
+    ASSERT_EXACT_FLOAT(_rfloat, "3.402_823_466e38", FLT_MAX);
+    ASSERT_EXACT_DOUBLE(_rdouble, "1.0e-400", 0.0);
+    ASSERT_EXACT_DOUBLE(_rdouble, "-1.0e-400", -0.0);
+    ASSERT_EXACT_DOUBLE(_rdouble, "1.0e400", HUGE_VAL);
+    ASSERT_EXACT_FLOAT(_rfloat, "1.0e39", HUGE_VALF);
+    ASSERT_EQ_DOUBLE(_rdouble, "1e", 0.0);
+    ASSERT_EQ_DOUBLE(_rdouble, "1e+-5", 0.0);
+    ASSERT_EQ_DOUBLE(_rdouble, "e5", 0.0);
+    ASSERT_EQ_DOUBLE(_rdouble, "1.5e3.2", 0.0);
+    ASSERT_EQ_DOUBLE(_rdouble, "+1.5", 0.0);
+    ASSERT_EQ_INT(_rint, "1e5", 0);
+
+    printf("\n==== CORRECT ROUNDING ====\n");
+    ASSERT_EXACT_DOUBLE(_rdouble, "0.1", 0.1);
+    ASSERT_EXACT_DOUBLE(_rdouble, "9007199254740993.0", 9007199254740992.0);
+    ASSERT_EXACT_DOUBLE(_rdouble, "9_007_199_254_740_993.000_000_000_000_000_000_001", 9007199254740994.0);
+    ASSERT_EXACT_DOUBLE(_rdouble, "2.2250738585072011e-308", 2.2250738585072011e-308);
+    ASSERT_EXACT_DOUBLE(_rdouble, "2.2250738585072012e-308", 2.2250738585072012e-308);
+    ASSERT_EXACT_DOUBLE(_rdouble, "4.9406564584124654e-324", 4.9406564584124654e-324);
+    ASSERT_EXACT_DOUBLE(_rdouble, "2.4703282292062327e-324", 0.0);
+    ASSERT_EXACT_DOUBLE(_rdouble, "2.4703282292062328e-324", 4.9406564584124654e-324);
+    ASSERT_EXACT_DOUBLE(_rdouble, "1.7976931348623158e308", DBL_MAX);
+    ASSERT_EXACT_FLOAT(_rfloat, "1.000000059604644775390625", 1.0f);
+    ASSERT_EXACT_FLOAT(_rfloat, "1.000000059604644775390625000000000001", 1.00000012f);
+    ASSERT_EXACT_FLOAT(_rfloat, "7.038531e-26", 7.038531e-26f);
+    ASSERT_EXACT_FLOAT(_rfloat, "1.4e-45", 1.4e-45f);
+
+    printf("\n==== AGREEMENT WITH STRTOD ====\n");
+    {
+        int mismatches = 0;
+        srand(42);
+        for(int i = 0; i < 100000; ++i) {
+            char digits[48];
+            if(i % 2) {
+                uint64_t bits = ((uint64_t)rand() << 40) ^ ((uint64_t)rand() << 20) ^ (uint64_t)rand();
+                double value;
+                memcpy(&value, &bits, sizeof(value));
+                if(isnan(value) || isinf(value)) continue;
+                sprintf(digits, "%.*e", rand() % 20, value);
+            } else {
+                int len = 1 + rand() % 30;
+                for(int j = 0; j < len; ++j) digits[j] = (char)('0' + rand() % 10);
+                digits[len] = '.';
+                sprintf(digits + len + 1, "%de%d", rand() % 10, rand() % 700 - 350);
+            }
+            if(_rdouble(digits) != strtod(digits, NULL) || _rfloat(digits) != strtof(digits, NULL)) {
+                if(mismatches++ < 5) printf("       mismatch on \"%s\"\n", digits);
+            }
+        }
+        total_tests++;
+        if(!mismatches) {
+            passed_tests++;
+            printf("[PASS] 100000 random inputs agree with strtod/strtof\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] %d of 100000 random inputs disagree with strtod/strtof\n", mismatches);
+        }
+    }
+
+    printf("\n==== BATCH PARSING ====\n");
+    {
+        const char* numbers[] = {"1_000", "-2,147,483,648", "12a34", "2_147_483_648", "3.5", "", "  42"};
+        const int expected[] = {1000, INT_MIN, 0, 0, 0, 0, 42};
+        const uint8_t expected_status[] = {
+            RSTATUS_OK, RSTATUS_OK, RSTATUS_INVALID_SYMBOL, RSTATUS_OVERFLOW,
+            RSTATUS_FLOAT_TO_INTEGER, RSTATUS_EMPTY, RSTATUS_OK
+        };
+        const size_t count = sizeof(numbers)/sizeof(*numbers);
+
+        for(unsigned threads = 1; threads <= 4; threads += 3) {
+            int out[sizeof(numbers)/sizeof(*numbers)];
+            uint8_t status[sizeof(numbers)/sizeof(*numbers)];
+            size_t failed = rparse_batch_int(numbers, count, out, status, threads);
+
+            total_tests++;
+            if(failed == 4 && !memcmp(out, expected, sizeof(out)) && !memcmp(status, expected_status, sizeof(status))) {
+                passed_tests++;
+                printf("[PASS] rparse_batch_int with %u thread(s)\n", threads);
+            } else {
+                failed_tests++;
+                printf("[FAIL] rparse_batch_int with %u thread(s): %zu failed\n", threads, failed);
+            }
+        }
+
+        const char* amounts[] = {"1,234.5", "-0.25", "1e3"};
+        double values[3];
+        uint8_t status[3];
+        total_tests++;
+        if(rparse_batch_double(amounts, 3, values, status, 2) == 0 &&
+           values[0] == 1234.5 && values[1] == -0.25 && values[2] == 1000.0) {
+            passed_tests++;
+            printf("[PASS] rparse_batch_double with 2 thread(s)\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparse_batch_double with 2 thread(s)\n");
+        }
+
+        unsigned long long big[2];
+        const char* unsigned_numbers[] = {"18_446_744_073_709_551_615", "-1"};
+        total_tests++;
+        if(rparse_batch_ulonglong(unsigned_numbers, 2, big, NULL, 0) == 1 && big[0] == ULLONG_MAX && big[1] == 0) {
+            passed_tests++;
+            printf("[PASS] rparse_batch_ulonglong without status array\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparse_batch_ulonglong without status array\n");
+        }
+    }
+
+    printf("\n==== FILE INGESTION ====\n");
+    {
+        const char* path = "creadable_test_file.tmp";
+        FILE* file = fopen(path, "w");
+        fputs("1_000;2.5;skip;-3\n"
+              "-2_147_483_648;1e3;x;4\r\n"
+              "12a34;0.25;;5\n"
+              "7;8.0\n"
+              ";1.0;;6\n"
+              "42;-0.5;y;65_535\n"
+              "1;2.0;3;4;5\n"
+              "9;9.0;9;9", file);
+        fclose(file);
+
+        const int expected_ids[] = {1000, INT_MIN, 0, 7, 0, 42, 1, 9};
+        const double expected_amounts[] = {2.5, 1000.0, 0.25, 8.0, 1.0, -0.5, 2.0, 9.0};
+        const unsigned short expected_counts[] = {0, 4, 5, 0, 6, 65535, 4, 9};
+        const unsigned char expected_errors[] = {0x5D};
+
+        for(unsigned threads = 1; threads <= 8; threads += 7) {
+            int ids[8];
+            double amounts[8];
+            unsigned short counts[8];
+            unsigned char errors[1];
+            const struct rcolumn columns[] = {
+                {RTYPE_INT, ids}, {RTYPE_DOUBLE, amounts}, {RTYPE_SKIP, NULL}, {RTYPE_USHORT, counts}
+            };
+            long long rows = rparse_file(path, ';', columns, 4, 8, errors, threads);
+
+            total_tests++;
+            if(rows == 8 && !memcmp(ids, expected_ids, sizeof(ids)) && !memcmp(amounts, expected_amounts, sizeof(amounts)) &&
+               !memcmp(counts, expected_counts, sizeof(counts)) &&
+               !memcmp(errors, expected_errors, sizeof(errors))) {
+                passed_tests++;
+                printf("[PASS] rparse_file with %u thread(s)\n", threads);
+            } else {
+                failed_tests++;
+                printf("[FAIL] rparse_file with %u thread(s): %lld rows, errors 0x%02X\n", threads, rows, errors[0]);
+            }
+        }
+
+        int first[2];
+        const struct rcolumn only_first[] = {{RTYPE_INT, first}};
+        total_tests++;
+        if(rparse_file(path, ';', only_first, 1, 2, NULL, 2) == 8 && first[0] == 1000 && first[1] == INT_MIN) {
+            passed_tests++;
+            printf("[PASS] rparse_file stops storing at max_rows\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparse_file stops storing at max_rows\n");
+        }
+
+        total_tests++;
+        if(rparse_file(path, '.', only_first, 1, 2, NULL, 1) == -1 && rparse_file(path, ',', only_first, 1, 2, NULL, 1) == -1 &&
+           rparse_file(path, '\n', only_first, 1, 2, NULL, 1) == -1 && rparse_file("creadable_missing.tmp", ';', only_first, 1, 2, NULL, 1) == -1) {
+            passed_tests++;
+            printf("[PASS] rparse_file rejects bad delimiters and missing files\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparse_file rejects bad delimiters and missing files\n");
+        }
+
+        // a NUL inside a field is a symbol like any other, not its end
+        file = fopen(path, "wb");
+        fwrite("12\0 34;5\n7;8\n", 1, 13, file);
+        fclose(file);
+        int a[2] = {-1, -1}, b[2] = {-1, -1};
+        unsigned char nul_errors[1];
+        const struct rcolumn pair[] = {{RTYPE_INT, a}, {RTYPE_INT, b}};
+        total_tests++;
+        if(rparse_file(path, ';', pair, 2, 2, nul_errors, 1) == 2 && nul_errors[0] == 0x01 && a[0] == 0 && b[0] == 5 && a[1] == 7 && b[1] == 8) {
+            passed_tests++;
+            printf("[PASS] rparse_file flags a NUL inside a field\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparse_file flags a NUL inside a field: a[0] = %d, errors 0x%02X\n", a[0], nul_errors[0]);
+        }
+        remove(path);
+    }
+
+    printf("\n==== DELIMITED BUFFERS ====\n");
+    {
+        const char* buffer = "1_000;2_500_000;-3;x;;4 000;18446744073709551616\r;7;";
+        long long values[8];
+        uint8_t status[8];
+        const long long expected_values[] = {1000, 2500000, -3, 0, 0, 4000, 0, 7};
+        const uint8_t expected_status[] = {0, 0, 0, RSTATUS_INVALID_SYMBOL, RSTATUS_EMPTY, 0, RSTATUS_INVALID_SYMBOL, 0};
+        long long fields = rparse_delimited(buffer, strlen(buffer), ';', RTYPE_LONGLONG, values, 8, status);
+        total_tests++;
+        if(fields == 8 && !memcmp(values, expected_values, sizeof(values)) && !memcmp(status, expected_status, sizeof(status))) {
+            passed_tests++;
+            printf("[PASS] rparse_delimited long long\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparse_delimited long long: %lld fields\n", fields);
+        }
+
+        const char* lines = "1_000.5\r\n-3.25\n4e2\n6.022_140_76e+23";
+        double doubles[4];
+        fields = rparse_delimited(lines, strlen(lines), '\n', RTYPE_DOUBLE, doubles, 4, NULL);
+        total_tests++;
+        if(fields == 4 && doubles[0] == 1000.5 && doubles[1] == -3.25 && doubles[2] == 400.0 && doubles[3] == 6.02214076e23) {
+            passed_tests++;
+            printf("[PASS] rparse_delimited double lines\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparse_delimited double lines: %lld fields\n", fields);
+        }
+
+        // 70 bytes: the index crosses a block boundary
+        const char* wide = "100|200|300|400|500|600|700|800|900|1_000|1_100|1_200|1_300|1_400|255";
+        size_t ends[16];
+        unsigned char small[3];
+        long long indexed = rindex_fields(wide, strlen(wide), '|', ends, 16);
+        long long counted = rindex_fields(wide, strlen(wide), '|', ends, 3);
+        long long truncated = rparse_delimited(wide, strlen(wide), '|', RTYPE_UCHAR, small, 3, status);
+        size_t failed = rparse_fields(wide, ends, 3, '|', RTYPE_UCHAR, small, status);
+        total_tests++;
+        if(indexed == 15 && ends[0] == 3 && ends[9] == 41 && counted == 15 && ends[2] == 11 &&
+           truncated == 15 && failed == 1 && small[0] == 100 && small[1] == 200 && small[2] == 0 &&
+           status[0] == RSTATUS_OK && status[1] == RSTATUS_OK && status[2] == RSTATUS_OVERFLOW) {
+            passed_tests++;
+            printf("[PASS] rindex_fields and rparse_fields\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rindex_fields and rparse_fields: %lld %lld %lld %zu\n", indexed, counted, truncated, failed);
+        }
+
+        total_tests++;
+        if(rparse_delimited("", 0, ';', RTYPE_INT, values, 8, status) == 0 && rindex_fields(";", 1, ';', ends, 16) == 1 && ends[0] == 0 &&
+           rparse_delimited("1,2", 3, ',', RTYPE_INT, values, 8, status) == -1 && rindex_fields("1 2", 3, ' ', ends, 16) == -1 &&
+           rparse_delimited("1_2", 3, '_', RTYPE_INT, values, 8, status) == -1 && rparse_delimited("1e2", 3, 'e', RTYPE_INT, values, 8, status) == -1 &&
+           rparse_delimited("1;2", 3, ';', RTYPE_SKIP, values, 8, status) == -1 &&
+           rparse_delimited("1\0-2\0" "3", 6, '\0', RTYPE_LONGLONG, values, 8, status) == 3 && values[0] == 1 && values[1] == -2 && values[2] == 3) {
+            passed_tests++;
+            printf("[PASS] rparse_delimited edge cases and rejected delimiters\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparse_delimited edge cases and rejected delimiters\n");
+        }
+
+        // a '\r' ends a field only where it ends a line, the same through
+        // rparse_delimited, rstream and rparse_file
+        static const struct {
+            const char* input;
+            char delimiter;
+            int values[2];
+            uint8_t status[2];
+        } carriage_cases[] = {
+            {"1\r;2", ';', {0, 2}, {RSTATUS_INVALID_SYMBOL, RSTATUS_OK}},
+            {"1\r\n2\r", '\n', {1, 2}, {RSTATUS_OK, RSTATUS_OK}},
+        };
+        int agree = 1;
+        for(size_t c = 0; c < 2; ++c) {
+            const char* input = carriage_cases[c].input;
+            int delimited[2] = {-1, -1};
+            uint8_t delimited_status[2];
+            if(rparse_delimited(input, strlen(input), carriage_cases[c].delimiter, RTYPE_INT, delimited, 2, delimited_status) != 2) agree = 0;
+
+            struct streamed streamed = {0};
+            streamed.size = sizeof(int);
+            rstream_t stream;
+            rstream_init(&stream, RTYPE_INT, carriage_cases[c].delimiter, collect_number, &streamed);
+            rstream_feed(&stream, input, strlen(input));
+            rstream_finish(&stream);
+            if(streamed.count != 2) agree = 0;
+
+            // one row of two columns, or two rows of one
+            const char* path = "creadable_test_carriage.tmp";
+            FILE* file = fopen(path, "wb");
+            fputs(input, file);
+            fclose(file);
+            int filed[2][2] = {{-1, -1}, {-1, -1}};
+            unsigned char row_errors[1] = {0};
+            int per_line = carriage_cases[c].delimiter == '\n' ? 1 : 2;
+            const struct rcolumn columns[] = {{RTYPE_INT, filed[0]}, {RTYPE_INT, filed[1]}};
+            long long rows = rparse_file(path, ';', columns, (size_t)per_line, 2, row_errors, 1);
+            remove(path);
+            if(rows != 2 / per_line) agree = 0;
+
+            for(int i = 0; i < 2; ++i) {
+                int streamed_value;
+                memcpy(&streamed_value, streamed.values[i].bytes, sizeof(int));
+                int filed_value = per_line == 1 ? filed[0][i] : filed[i][0];
+                int row_failed = (row_errors[0] >> (per_line == 1 ? i : 0)) & 1;
+                uint8_t expected = carriage_cases[c].status[i];
+                if(delimited[i] != carriage_cases[c].values[i] || delimited_status[i] != expected ||
+                   streamed_value != carriage_cases[c].values[i] || streamed.results[i].status != expected ||
+                   filed_value != carriage_cases[c].values[i] || (expected && !row_failed)) {
+                    agree = 0;
+                }
+            }
+        }
+        total_tests++;
+        if(agree) {
+            passed_tests++;
+            printf("[PASS] a '\\r' is ignored only at a line end by all three APIs\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] a '\\r' is ignored only at a line end by all three APIs\n");
+        }
+
+        // more fields than one index block, checked against rlonglong_ex on
+        // each field split by hand
+        enum { COUNT = 5000 };
+        static char text[COUNT*32];
+        static long long parsed[COUNT];
+        static uint8_t outcome[COUNT];
+        static size_t field_starts[COUNT + 1];
+        size_t length = 0;
+        srand(23);
+        for(int i = 0; i < COUNT; ++i) {
+            field_starts[i] = length;
+            long long value = ((long long)rand() << 31 | rand()) % 2000000000000LL - 1000000000000LL;
+            switch(rand() % 5) {
+            case 0: length += (size_t)sprintf(text + length, "%lld", value); break;
+            case 1: length += (size_t)sprintf(text + length, "%lld_%03d", value / 1000, abs((int)(value % 1000))); break;
+            case 2: length += (size_t)sprintf(text + length, " %lld", value); break;
+            case 3: length += (size_t)sprintf(text + length, "%lldz", value); break;
+            default: break; // empty field
+            }
+            text[length++] = ';';
+        }
+        field_starts[COUNT] = length;
+        fields = rparse_delimited(text, length, ';', RTYPE_LONGLONG, parsed, COUNT, outcome);
+        int mismatches = 0;
+        for(int i = 0; i < COUNT; ++i) {
+            struct rresult result;
+            long long value;
+            char field[32];
+            size_t field_length = field_starts[i + 1] - 1 - field_starts[i];
+            memcpy(field, text + field_starts[i], field_length);
+            field[field_length] = '\0';
+            result = rlonglong_ex(field, &value);
+            if(result.status != outcome[i] || (!result.status && value != parsed[i])) ++mismatches;
+        }
+        total_tests++;
+        if(fields == COUNT && !mismatches) {
+            passed_tests++;
+            printf("[PASS] rparse_delimited matches rlonglong_ex on %d random fields\n", COUNT);
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparse_delimited: %lld fields, %d mismatches\n", fields, mismatches);
+        }
+    }
+
+    printf("\n==== GENERIC DISPATCH ====\n");
+    {
+        char c; signed char sc; unsigned char uc;
+        short s; unsigned short us;
+        int i; unsigned int ui;
+        long l; long long ll; unsigned long ul; unsigned long long ull;
+        float f; double d; long double ld;
+
+        ASSERT_RPARSE(c, 'A', 6_5);
+        ASSERT_RPARSE(sc, SCHAR_MIN, -128);
+        ASSERT_RPARSE(uc, UCHAR_MAX, 2_55);
+        ASSERT_RPARSE(s, SHRT_MIN, -32,768);
+        ASSERT_RPARSE(us, USHRT_MAX, 65 535);
+        ASSERT_RPARSE(i, 1000000, 1_000_000);
+        ASSERT_RPARSE(ui, UINT_MAX, 4,294,967,295);
+        ASSERT_RPARSE(l, -1234567L, -1_234_567);
+        ASSERT_RPARSE(ll, LLONG_MIN, -9,223,372,036,854,775,808);
+        ASSERT_RPARSE(ul, 4294967295UL, 4_294_967_295);
+        ASSERT_RPARSE(ull, ULLONG_MAX, 18,446,744,073,709,551,615);
+        ASSERT_RPARSE(f, 0.5f, 0.5);
+        ASSERT_RPARSE(d, -1234.5, -1,234.5);
+        ASSERT_RPARSE(ld, 0.25L, 0.2_5);
+        ASSERT_RPARSE(i, 0, 12a34);
+        ASSERT_RPARSE(uc, 0, 256);
+        ASSERT_RPARSE(ull, 0xFFFFFFFF00000000ULL, 0xFFFF_FFFF_0000_0000);
+        ASSERT_RPARSE(uc, 0xA5, 0b1010_0101);
+    }
+
+    printf("\n==== STATUS RESULTS ====\n");
+    {
+        int i; unsigned int ui; long long ll; unsigned char uc; float f; double d;
+        ASSERT_RESULT(rint_ex("1_000", &i), i, 1000, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex("0", &i), i, 0, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex("12a34", &i), i, 0, RSTATUS_INVALID_SYMBOL, 2);
+        ASSERT_RESULT(rint_ex("1_000,000", &i), i, 0, RSTATUS_SEPARATOR_MISMATCH, 5);
+        ASSERT_RESULT(rint_ex("", &i), i, 0, RSTATUS_EMPTY, 0);
+        ASSERT_RESULT(rint_ex("2_147_483_648", &i), i, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rlonglong_ex("-9_223_372_036_854_775_809", &ll), ll, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(ruint_ex("-1", &ui), ui, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(ruchar_ex("1.5", &uc), uc, 0, RSTATUS_FLOAT_TO_INTEGER, 0);
+        ASSERT_RESULT(rdouble_ex("1e", &d), d, 0, RSTATUS_MISSING_EXPONENT, 1);
+        ASSERT_RESULT(rdouble_ex("1.2.3", &d), d, 0, RSTATUS_MISPLACED_SYMBOL, 3);
+        ASSERT_RESULT(rfloat_ex("-0.5", &f), f, -0.5f, RSTATUS_OK, 0);
+        ASSERT_RESULT(rfloat_ex("5", &f), f, 0, RSTATUS_INTEGER_TO_FLOAT, 0);
+    }
+
+    printf("\n==== RADIX LITERALS ====\n");
+    {
+        char c; signed char sc; unsigned char uc; short s; unsigned short us; int i; unsigned int ui;
+        long l; long long ll; unsigned long ul; unsigned long long ull;
+        ASSERT_EQ_ULLONG(_rulonglong, "0xFFFF_FFFF_0000_0000", 0xFFFFFFFF00000000ULL);
+        ASSERT_EQ_INT(_rint, "0b1010_0101", 0xA5);
+        ASSERT_EQ_INT(_rint, "0o755", 0755);
+        ASSERT_EQ_UINT(_ruint, "0xdead BEEF", 0xDEADBEEFU);
+        ASSERT_EQ_UINT(_ruint, "0XFF,FF", 0xFFFFU);
+        ASSERT_EQ_UINT(_ruint, "0x0000_0000_0000_0000_0000_0001", 1U);
+        ASSERT_EQ_INT(_rint, "007", 7);
+        ASSERT_RESULT(rint_ex("0x", &i), i, 0, RSTATUS_MISPLACED_SYMBOL, 1);
+        ASSERT_RESULT(rint_ex("0b102", &i), i, 0, RSTATUS_INVALID_SYMBOL, 4);
+        ASSERT_RESULT(rint_ex("0o78", &i), i, 0, RSTATUS_INVALID_SYMBOL, 3);
+        ASSERT_RESULT(rint_ex("0x1_000,0", &i), i, 0, RSTATUS_SEPARATOR_MISMATCH, 7);
+        ASSERT_RESULT(rint_ex("0x1.8", &i), i, 0, RSTATUS_MISPLACED_SYMBOL, 3);
+        ASSERT_RESULT(rint_ex("00x1", &i), i, 0, RSTATUS_INVALID_SYMBOL, 2);
+        ASSERT_RESULT(rulonglong_ex("0x1_0000_0000_0000_0000_0000_0000_0000_0000", &ull), ull, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_PREFIX(_rint_n, "0x1F;", 5, 0x1F, 4);
+        ASSERT_PREFIX(_rint_n, "0x1F_;", 6, 0x1F, 4);
+        ASSERT_PREFIX(_rint_n, "0xg", 3, 0, 1);
+        ASSERT_PREFIX(_rint_n, "0b12", 4, 1, 3);
+        ASSERT_PREFIX(_rint_n, "0x", 2, 0, 1);
+        ASSERT_RESULT(rchar_ex("0x7F", &c), c, CHAR_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rchar_ex("0x80", &c), c, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rchar_ex("-0x80", &c), c, CHAR_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rchar_ex("-0x81", &c), c, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rchar_ex("0o177", &c), c, CHAR_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rchar_ex("0o200", &c), c, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rchar_ex("-0o200", &c), c, CHAR_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rchar_ex("-0o201", &c), c, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rchar_ex("0b111_1111", &c), c, CHAR_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rchar_ex("0b1000_0000", &c), c, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rchar_ex("-0b1000_0000", &c), c, CHAR_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rchar_ex("-0b1000_0001", &c), c, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rschar_ex("0x7F", &sc), sc, SCHAR_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rschar_ex("0x80", &sc), sc, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rschar_ex("-0x80", &sc), sc, SCHAR_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rschar_ex("-0x81", &sc), sc, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rschar_ex("0o177", &sc), sc, SCHAR_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rschar_ex("0o200", &sc), sc, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rschar_ex("-0o200", &sc), sc, SCHAR_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rschar_ex("-0o201", &sc), sc, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rschar_ex("0b111_1111", &sc), sc, SCHAR_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rschar_ex("0b1000_0000", &sc), sc, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rschar_ex("-0b1000_0000", &sc), sc, SCHAR_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rschar_ex("-0b1000_0001", &sc), sc, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(ruchar_ex("0xFF", &uc), uc, UCHAR_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(ruchar_ex("0x100", &uc), uc, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ruchar_ex("-0x1", &uc), uc, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(ruchar_ex("0o377", &uc), uc, UCHAR_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(ruchar_ex("0o400", &uc), uc, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ruchar_ex("-0o1", &uc), uc, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(ruchar_ex("0b1111_1111", &uc), uc, UCHAR_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(ruchar_ex("0b1_0000_0000", &uc), uc, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ruchar_ex("-0b1", &uc), uc, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rshort_ex("0x7FFF", &s), s, SHRT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rshort_ex("0x8000", &s), s, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rshort_ex("-0x8000", &s), s, SHRT_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rshort_ex("-0x8001", &s), s, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rshort_ex("0o77_777", &s), s, SHRT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rshort_ex("0o100_000", &s), s, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rshort_ex("-0o100_000", &s), s, SHRT_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rshort_ex("-0o100_001", &s), s, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rshort_ex("0b111_1111_1111_1111", &s), s, SHRT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rshort_ex("0b1000_0000_0000_0000", &s), s, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rshort_ex("-0b1000_0000_0000_0000", &s), s, SHRT_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rshort_ex("-0b1000_0000_0000_0001", &s), s, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rushort_ex("0xFFFF", &us), us, USHRT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rushort_ex("0x1_0000", &us), us, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rushort_ex("-0x1", &us), us, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rushort_ex("0o177_777", &us), us, USHRT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rushort_ex("0o200_000", &us), us, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rushort_ex("-0o1", &us), us, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rushort_ex("0b1111_1111_1111_1111", &us), us, USHRT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rushort_ex("0b1_0000_0000_0000_0000", &us), us, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rushort_ex("-0b1", &us), us, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rint_ex("0x7FFF_FFFF", &i), i, INT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex("0x8000_0000", &i), i, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rint_ex("-0x8000_0000", &i), i, INT_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex("-0x8000_0001", &i), i, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rint_ex("0o17_777_777_777", &i), i, INT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex("0o20_000_000_000", &i), i, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rint_ex("-0o20_000_000_000", &i), i, INT_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex("-0o20_000_000_001", &i), i, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rint_ex("0b111_1111_1111_1111_1111_1111_1111_1111", &i), i, INT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex("0b1000_0000_0000_0000_0000_0000_0000_0000", &i), i, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rint_ex("-0b1000_0000_0000_0000_0000_0000_0000_0000", &i), i, INT_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex("-0b1000_0000_0000_0000_0000_0000_0000_0001", &i), i, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(ruint_ex("0xFFFF_FFFF", &ui), ui, UINT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(ruint_ex("0x1_0000_0000", &ui), ui, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ruint_ex("-0x1", &ui), ui, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(ruint_ex("0o37_777_777_777", &ui), ui, UINT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(ruint_ex("0o40_000_000_000", &ui), ui, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ruint_ex("-0o1", &ui), ui, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(ruint_ex("0b1111_1111_1111_1111_1111_1111_1111_1111", &ui), ui, UINT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(ruint_ex("0b1_0000_0000_0000_0000_0000_0000_0000_0000", &ui), ui, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ruint_ex("-0b1", &ui), ui, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rlong_ex("0x7FFF_FFFF_FFFF_FFFF", &l), l, LONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlong_ex("0x8000_0000_0000_0000", &l), l, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rlong_ex("-0x8000_0000_0000_0000", &l), l, LONG_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlong_ex("-0x8000_0000_0000_0001", &l), l, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rlong_ex("0o777_777_777_777_777_777_777", &l), l, LONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlong_ex("0o1_000_000_000_000_000_000_000", &l), l, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rlong_ex("-0o1_000_000_000_000_000_000_000", &l), l, LONG_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlong_ex("-0o1_000_000_000_000_000_000_001", &l), l, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rlong_ex("0b111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111", &l), l, LONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlong_ex("0b1000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000", &l), l, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rlong_ex("-0b1000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000", &l), l, LONG_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlong_ex("-0b1000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0001", &l), l, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rlonglong_ex("0x7FFF_FFFF_FFFF_FFFF", &ll), ll, LLONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlonglong_ex("0x8000_0000_0000_0000", &ll), ll, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rlonglong_ex("-0x8000_0000_0000_0000", &ll), ll, LLONG_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlonglong_ex("-0x8000_0000_0000_0001", &ll), ll, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rlonglong_ex("0o777_777_777_777_777_777_777", &ll), ll, LLONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlonglong_ex("0o1_000_000_000_000_000_000_000", &ll), ll, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rlonglong_ex("-0o1_000_000_000_000_000_000_000", &ll), ll, LLONG_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlonglong_ex("-0o1_000_000_000_000_000_000_001", &ll), ll, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rlonglong_ex("0b111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111", &ll), ll, LLONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlonglong_ex("0b1000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000", &ll), ll, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rlonglong_ex("-0b1000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000", &ll), ll, LLONG_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlonglong_ex("-0b1000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0001", &ll), ll, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rulong_ex("0xFFFF_FFFF_FFFF_FFFF", &ul), ul, ULONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rulong_ex("0x1_0000_0000_0000_0000", &ul), ul, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rulong_ex("-0x1", &ul), ul, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rulong_ex("0o1_777_777_777_777_777_777_777", &ul), ul, ULONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rulong_ex("0o2_000_000_000_000_000_000_000", &ul), ul, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rulong_ex("-0o1", &ul), ul, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rulong_ex("0b1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111", &ul), ul, ULONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rulong_ex("0b1_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000", &ul), ul, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rulong_ex("-0b1", &ul), ul, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rulonglong_ex("0xFFFF_FFFF_FFFF_FFFF", &ull), ull, ULLONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rulonglong_ex("0x1_0000_0000_0000_0000", &ull), ull, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rulonglong_ex("-0x1", &ull), ull, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rulonglong_ex("0o1_777_777_777_777_777_777_777", &ull), ull, ULLONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rulonglong_ex("0o2_000_000_000_000_000_000_000", &ull), ull, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rulonglong_ex("-0o1", &ull), ull, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(rulonglong_ex("0b1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111_1111", &ull), ull, ULLONG_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rulonglong_ex("0b1_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000_0000", &ull), ull, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rulonglong_ex("-0b1", &ull), ull, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+    }
+
+#ifdef __SIZEOF_INT128__
+    printf("\n==== 128-BIT INTEGERS ====\n");
+    {
+        __int128 i;
+        unsigned __int128 u;
+        const unsigned __int128 ten19 = 10000000000000000000ULL;
+        const unsigned __int128 u128_max = ~(unsigned __int128)0;
+        const __int128 i128_max = (__int128)(u128_max >> 1);
+        const __int128 i128_min = -i128_max - 1;
+        ASSERT_RESULT(ru128_ex("0", &u), u, 0, RSTATUS_OK, 0);
+        ASSERT_RESULT(ru128_ex("18_446_744_073_709_551_616", &u), u, (unsigned __int128)1 << 64, RSTATUS_OK, 0);
+        ASSERT_RESULT(ru128_ex("1234567890123456789", &u), u, 1234567890123456789ULL, RSTATUS_OK, 0);
+        ASSERT_RESULT(ru128_ex("12345678901234567890", &u), u, 12345678901234567890ULL, RSTATUS_OK, 0);
+        ASSERT_RESULT(ru128_ex("1,0000000000000000000", &u), u, ten19, RSTATUS_OK, 0);
+        ASSERT_RESULT(ru128_ex("99999999999999999999999999999999999999", &u), u, ten19*ten19 - 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(ri128_ex("-1", &i), i, -1, RSTATUS_OK, 0);
+        ASSERT_RESULT(ri128_ex("170,141,183,460,469,231,731,687,303,715,884,105,727", &i), i, i128_max, RSTATUS_OK, 0);
+        ASSERT_RESULT(ri128_ex("170_141_183_460_469_231_731_687_303_715_884_105_728", &i), i, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ri128_ex("-170 141 183 460 469 231 731 687 303 715 884 105 728", &i), i, i128_min, RSTATUS_OK, 0);
+        ASSERT_RESULT(ri128_ex("-170141183460469231731687303715884105729", &i), i, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(ru128_ex("340_282_366_920_938_463_463_374_607_431_768_211_455", &u), u, u128_max, RSTATUS_OK, 0);
+        ASSERT_RESULT(ru128_ex("340282366920938463463374607431768211456", &u), u, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ru128_ex("3402823669209384634633746074317682114559", &u), u, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ru128_ex("999999999999999999999999999999999999999", &u), u, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ru128_ex("-1", &u), u, 0, RSTATUS_NEGATIVE_UNSIGNED, 0);
+        ASSERT_RESULT(ru128_ex("1.5", &u), u, 0, RSTATUS_FLOAT_TO_INTEGER, 0);
+        ASSERT_RESULT(ru128_ex("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", &u), u, u128_max, RSTATUS_OK, 0);
+        ASSERT_RESULT(ru128_ex("0x1_0000_0000_0000_0000_0000_0000_0000_0000", &u), u, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ru128_ex("0b11111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111111", &u), u, u128_max, RSTATUS_OK, 0);
+        ASSERT_RESULT(ru128_ex("0b100000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000", &u), u, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(ru128_ex("0o3777777777777777777777777777777777777777777", &u), u, u128_max, RSTATUS_OK, 0);
+        ASSERT_RESULT(ri128_ex("-0x80000000000000000000000000000000", &i), i, i128_min, RSTATUS_OK, 0);
+        ASSERT_RESULT(ri128_ex("0x80000000000000000000000000000000", &i), i, 0, RSTATUS_OVERFLOW, 0);
+        total_tests++;
+        if(_ru128("340,282,366,920,938,463,463,374,607,431,768,211,455") == u128_max && ru128(340_282_366_920_938_463_463_374_607_431_768_211_455) == u128_max &&
+           ri128(-170 141 183 460 469 231 731 687 303 715 884 105 728) == i128_min) {
+            passed_tests++;
+            printf("[PASS] _ru128/ru128/ri128 at the boundaries\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] _ru128/ru128/ri128 at the boundaries\n");
+        }
+        ASSERT_PREFIX(_ri128_n, "-12_345_678_901_234_567_890_123;", 32, -(__int128)12345678901234567890ULL*1000 - 123, 31);
+    }
+
+#endif
+    printf("\n==== PARSER CONFIGURATION ====\n");
+    {
+        struct rparser european, swiss, plus, standard;
+        int i; long long ll; unsigned int ui; double d; float f;
+        rparser_init(&european, ".", ',', 0);
+        rparser_init(&swiss, "'", '.', 0);
+        rparser_init(&plus, NULL, '\0', RPARSER_PLUS_SIGN);
+        rparser_init(&standard, NULL, '\0', 0);
+        ASSERT_RESULT(rdouble_ex_with("1.234.567,89", &d, &european), d, 1234567.89, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdouble_ex_with("-0,5", &d, &european), d, -0.5, RSTATUS_OK, 0);
+        ASSERT_RESULT(rfloat_ex_with("1,5e3", &f, &european), f, 1500.0f, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex_with("1.000.000", &i, &european), i, 1000000, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex_with("1_000", &i, &european), i, 0, RSTATUS_INVALID_SYMBOL, 1);
+        ASSERT_RESULT(rint_ex_with("1,5", &i, &european), i, 0, RSTATUS_FLOAT_TO_INTEGER, 0);
+        ASSERT_RESULT(rdouble_ex_with("1,2,3", &d, &european), d, 0, RSTATUS_MISPLACED_SYMBOL, 3);
+        ASSERT_RESULT(rint_ex_with("1 000", &i, &european), i, 0, RSTATUS_INVALID_SYMBOL, 1);
+        ASSERT_RESULT(rint_ex_with("  1.000  ", &i, &european), i, 1000, RSTATUS_OK, 0);
+        ASSERT_RESULT(ruint_ex_with("0xFFFF.FFFF", &ui, &european), ui, UINT_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rlonglong_ex_with("-9'223'372'036'854'775'808", &ll, &swiss), ll, LLONG_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdouble_ex_with("1'234.5", &d, &swiss), d, 1234.5, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex_with("1,234", &i, &swiss), i, 0, RSTATUS_INVALID_SYMBOL, 1);
+        ASSERT_RESULT(rint_ex_with("+42", &i, &plus), i, 42, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdouble_ex_with("+1.5e+2", &d, &plus), d, 150.0, RSTATUS_OK, 0);
+        ASSERT_RESULT(rint_ex_with("++42", &i, &plus), i, 0, RSTATUS_MISPLACED_SYMBOL, 1);
+        ASSERT_RESULT(rint_ex_with("+-42", &i, &plus), i, 0, RSTATUS_MISPLACED_SYMBOL, 1);
+        ASSERT_RESULT(rint_ex_with("+42", &i, &standard), i, 0, RSTATUS_MISPLACED_SYMBOL, 0);
+        ASSERT_RESULT(rdouble_ex_with("1e+2", &d, &standard), d, 100.0, RSTATUS_OK, 0);
+
+        // the default configuration reads exactly what r*_ex() reads
+        const char* inputs[] = {"1_000", "1,000,000", "1 000", " 7 ", "-0.5e-3", "1_000,000", "12a34", "0x_FF", "1.2.3", "-", "", "+1", "1e", "0b1_0"};
+        int mismatches = 0;
+        for(size_t k = 0; k < sizeof(inputs)/sizeof(*inputs); ++k) {
+            int a, b;
+            double x, y;
+            struct rresult ra = rint_ex(inputs[k], &a), rb = rint_ex_with(inputs[k], &b, &standard);
+            struct rresult rx = rdouble_ex(inputs[k], &x), ry = rdouble_ex_with(inputs[k], &y, &standard);
+            if(ra.status != rb.status || ra.offset != rb.offset || a != b) ++mismatches;
+            if(rx.status != ry.status || rx.offset != ry.offset || x != y) ++mismatches;
+        }
+        total_tests++;
+        if(!mismatches) {
+            passed_tests++;
+            printf("[PASS] rparser_init() defaults match r*_ex()\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparser_init() defaults match r*_ex(): %d mismatches\n", mismatches);
+        }
+
+        struct captured_errors captured = {0};
+        struct rparser invalid;
+        rset_error_handler(capture_error, &captured, 0);
+        total_tests++;
+        if(rparser_init(&invalid, ".", '.', 0) == RSTATUS_INVALID_ARGUMENT &&
+           rparser_init(&invalid, "x", '.', 0) == RSTATUS_INVALID_ARGUMENT &&
+           rparser_init(&invalid, "_", 'e', 0) == RSTATUS_INVALID_ARGUMENT &&
+           rparser_init(&invalid, "-", ',', 0) == RSTATUS_INVALID_ARGUMENT &&
+           captured.count == 4 && captured.last == RSTATUS_INVALID_ARGUMENT) {
+            passed_tests++;
+            printf("[PASS] rparser_init() refuses clashing characters\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rparser_init() refuses clashing characters\n");
+        }
+        rset_error_handler(NULL, NULL, 0);
+    }
+
+    printf("\n==== PREFIX PARSING ====\n");
+    {
+        ASSERT_PREFIX(_rint_n, "123", 3, 123, 3);
+        ASSERT_PREFIX(_rint_n, "1_000;", 6, 1000, 5);
+        ASSERT_PREFIX(_rint_n, "  42 apples", 11, 42, 4);
+        ASSERT_PREFIX(_rint_n, "1 000 apples", 12, 1000, 5);
+        ASSERT_PREFIX(_rint_n, "12_", 3, 12, 2);
+        ASSERT_PREFIX(_rint_n, "12,a", 4, 12, 2);
+        ASSERT_PREFIX(_rint_n, "12345", 3, 123, 3);
+        ASSERT_PREFIX(_rint_n, "-7-", 3, -7, 2);
+        ASSERT_PREFIX(_rint_n, "x", 1, 0, 0);
+        ASSERT_PREFIX(_rint_n, "", 0, 0, 0);
+        ASSERT_PREFIX(_rint_n, "-x", 2, 0, 0);
+        ASSERT_PREFIX(_ruchar_n, "255)", 4, 255, 3);
+        ASSERT_PREFIX(_ruchar_n, "256)", 4, 0, 3);
+        ASSERT_PREFIX(_rint_n, "1.5", 3, 0, 3);
+        ASSERT_PREFIX(_rint_n, "7.", 2, 7, 1);
+        ASSERT_PREFIX(_rlonglong_n, "-9,223,372,036,854,775,808]", 27, LLONG_MIN, 26);
+        ASSERT_PREFIX(_rulonglong_n, "18_446_744_073_709_551_615 ", 27, ULLONG_MAX, 26);
+        ASSERT_PREFIX(_rdouble_n, "-2,5e3 x", 8, -25e3, 6);
+        ASSERT_PREFIX(_rdouble_n, "1.25e", 5, 1.25, 4);
+        ASSERT_PREFIX(_rdouble_n, "1.25e+", 6, 1.25, 4);
+        ASSERT_PREFIX(_rdouble_n, "1.25e-2", 7, 0.0125, 7);
+        ASSERT_PREFIX(_rdouble_n, "1.25else", 8, 1.25, 4);
+        ASSERT_PREFIX(_rfloat_n, "0.5f", 4, 0.5f, 3);
+        ASSERT_PREFIX(_rlongdouble_n, "0.2_5|", 6, 0.25L, 5);
+
+        // walk a field list in place: no copies, no terminators, no strlen
+        static const char fields[] = {'1', '_', '0', '0', '0', ';', '-', '2', '.', '5', ';', '3', '0', ';', '7'};
+        const char* p = fields;
+        const char* end = fields + sizeof(fields);
+        double values[4];
+        int count = 0;
+        while(p < end && count < 4) {
+            if(count == 1) values[count] = _rdouble_n(p, (size_t)(end - p), &p);
+            else values[count] = _rint_n(p, (size_t)(end - p), &p);
+            ++count;
+            if(p < end) ++p;
+        }
+        total_tests++;
+        if(count == 4 && values[0] == 1000 && values[1] == -2.5 && values[2] == 30 && values[3] == 7 && p == end) {
+            passed_tests++;
+            printf("[PASS] walk an unterminated field list\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] walk an unterminated field list\n");
+        }
+
+        // the error names only the consumed bytes
+        struct captured_errors captured = {0};
+        rset_error_handler(capture_error, &captured, 0);
+        _rchar_n("1000 more", 9, NULL);
+        total_tests++;
+        if(captured.count == 1 && !strcmp(captured.first_message, "[CREADABLE ERROR] 1000 overflows char type. Defaulting to zero.")) {
+            passed_tests++;
+            printf("[PASS] prefix errors report the consumed bytes\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] prefix errors report the consumed bytes: \"%s\"\n", captured.first_message);
+        }
+        rset_error_handler(NULL, NULL, 0);
+    }
+
+    printf("\n==== VALIDATION ====\n");
+    ASSERT_VALIDATE("1_000_000", RSTATUS_OK, 0);
+    ASSERT_VALIDATE("   -42", RSTATUS_OK, 0);
+    ASSERT_VALIDATE("6.022_140_76e+23", RSTATUS_OK, 0);
+    ASSERT_VALIDATE("-1 234.5e-3  ", RSTATUS_OK, 0);
+    ASSERT_VALIDATE("0xFFFF_FFFF", RSTATUS_OK, 0);
+    ASSERT_VALIDATE("12", RSTATUS_OK, 0);
+    ASSERT_VALIDATE("", RSTATUS_EMPTY, 0);
+    ASSERT_VALIDATE("_  ", RSTATUS_EMPTY, 0);
+    ASSERT_VALIDATE("12a34", RSTATUS_INVALID_SYMBOL, 2);
+    ASSERT_VALIDATE("1_000,000", RSTATUS_SEPARATOR_MISMATCH, 5);
+    ASSERT_VALIDATE("1 000\t000", RSTATUS_SEPARATOR_MISMATCH, 5);
+    ASSERT_VALIDATE("1.2.3", RSTATUS_MISPLACED_SYMBOL, 3);
+    ASSERT_VALIDATE("1-2", RSTATUS_MISPLACED_SYMBOL, 1);
+    ASSERT_VALIDATE("+1", RSTATUS_MISPLACED_SYMBOL, 0);
+    ASSERT_VALIDATE(".5", RSTATUS_MISPLACED_SYMBOL, 0);
+    ASSERT_VALIDATE("1e5.0", RSTATUS_MISPLACED_SYMBOL, 3);
+    ASSERT_VALIDATE("1e", RSTATUS_MISSING_EXPONENT, 1);
+    ASSERT_VALIDATE("1_000_000_000_000_000_000_000_000_000_000_000_000_000_000_000_000_000", RSTATUS_OK, 0);
+    ASSERT_VALIDATE("1_000_000_000_000_000_000_000_000_000_000_000_000_000_000_000_000_000,0", RSTATUS_SEPARATOR_MISMATCH, 69);
+    {
+        // only the first 3 bytes count, and a NUL before them is a symbol
+        struct rresult nul = rvalidate("12\0" "34", 5);
+        total_tests++;
+        if(!rvalidate("123abc", 3).status && nul.status == RSTATUS_INVALID_SYMBOL && nul.offset == 2 && rvalidate("12a", 3).status == RSTATUS_INVALID_SYMBOL) {
+            passed_tests++;
+            printf("[PASS] rvalidate() stops at length, not at NUL\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rvalidate() stops at length, not at NUL\n");
+        }
+
+        const char* numbers[10] = {"1", "x", "2_000", "1,000_000", "3.5", "-", "4e4", "5", "6", "1.2.3"};
+        unsigned char invalid[2] = {0xFF, 0xFF};
+        size_t failed = rvalidate_batch(numbers, 10, invalid);
+        total_tests++;
+        if(failed == 4 && invalid[0] == 0x2A && invalid[1] == 0x02) {
+            passed_tests++;
+            printf("[PASS] rvalidate_batch() flags fields 1, 3, 5 and 9\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rvalidate_batch() returned %zu, flags %02x %02x\n", failed, invalid[0], invalid[1]);
+        }
+
+        // the same verdict and offset as the parsers on random input
+        static const char alphabet[] = "0123456789000111_,_ .e-+E\t5x0bo-";
+        int mismatches = 0;
+        srand(19);
+        for(int i = 0; i < 200000; ++i) {
+            char input[400];
+            int len = rand() % (i % 3 ? 12 : i % 2 ? 79 : 399);
+            for(int j = 0; j < len; ++j) input[j] = alphabet[rand() % (sizeof(alphabet) - 1)];
+            if(i % 4 == 0) {
+                // mostly well formed and spanning several 64 byte blocks,
+                // with one stray byte now and then
+                static const char separators[] = "_, \t";
+                char separator = separators[rand() % 4];
+                len = 0;
+                if(rand() % 2) input[len++] = '-';
+                int digits = 1 + rand() % 150;
+                for(int j = 0; j < digits; ++j) {
+                    input[len++] = (char)('0' + rand() % 10);
+                    if(rand() % 4 == 0) input[len++] = separator;
+                }
+                if(rand() % 2) input[len++] = '.';
+                for(int j = rand() % 40; j > 0; --j) input[len++] = (char)('0' + rand() % 10);
+                if(rand() % 2) {
+                    input[len++] = 'e';
+                    if(rand() % 2) input[len++] = rand() % 2 ? '-' : '+';
+                    for(int j = rand() % 4; j > 0; --j) input[len++] = (char)('0' + rand() % 10);
+                }
+                for(int j = rand() % 3; j > 0; --j) input[len++] = ' ';
+                if(rand() % 2) input[rand() % len] = alphabet[rand() % (sizeof(alphabet) - 1)];
+            }
+            input[len] = '\0';
+            double value;
+            struct rresult expected = rdouble_ex(input, &value);
+            if(expected.status == RSTATUS_INTEGER_TO_FLOAT) expected.status = RSTATUS_OK;
+            struct rresult result = rvalidate(input, (size_t)len);
+            if(result.status != expected.status || result.offset != expected.offset) {
+                if(mismatches++ < 5) printf("       mismatch on \"%s\"\n", input);
+            }
+        }
+        total_tests++;
+        if(!mismatches) {
+            passed_tests++;
+            printf("[PASS] 200000 random inputs validate like rdouble_ex\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] %d of 200000 random inputs validate unlike rdouble_ex\n", mismatches);
+        }
+    }
+
+    printf("\n==== CPU DISPATCH ====\n");
+    {
+        // make dispatch_test runs everything again at each level
+        const char* levels[] = {"scalar", "sse2", "avx2", "avx512"};
+        const char* forced = getenv("CREADABLE_SIMD");
+        int level = -1, cap = 3;
+        for(int i = 0; i < 4; ++i) {
+            if(!strcmp(rsimd_level(), levels[i])) level = i;
+            if(forced && !strcmp(forced, levels[i])) cap = i;
+        }
+        total_tests++;
+        if(level >= 0 && level <= cap) {
+            passed_tests++;
+            printf("[PASS] rsimd_level() is %s\n", rsimd_level());
+        } else {
+            failed_tests++;
+            printf("[FAIL] rsimd_level() is %s with CREADABLE_SIMD=%s\n", rsimd_level(), forced ? forced : "");
+        }
+
+        // runs of every length across the vector blocks, alone and in groups
+        char digits[400], grouped[800], stripped[400];
+        int failures = 0;
+        srand(22);
+        for(int length = 1; length <= 200; ++length) {
+            for(int i = 0; i < length; ++i) digits[i] = (char)('0' + (i ? rand() % 10 : 1 + rand() % 9));
+            digits[length] = '\0';
+            unsigned long long value = 0;
+            struct rresult result = rulonglong_ex(digits, &value);
+            if(length <= 19 || (length == 20 && strcmp(digits, "18446744073709551615") <= 0)) {
+                if(result.status || value != strtoull(digits, NULL, 10)) ++failures;
+            }
+            else if(result.status != RSTATUS_OVERFLOW) ++failures;
+
+            size_t g = 0, s = 0;
+            for(int i = 0; i < length;) {
+                int run = 1 + rand() % 70;
+                if(i && i + 2 < length && grouped[g - 1] != '.') grouped[g++] = '_';
+                for(; run && i < length; --run, ++i) {
+                    grouped[g++] = stripped[s++] = digits[i];
+                    if(i == (length - 1) / 2) grouped[g++] = stripped[s++] = '.';
+                }
+            }
+            if(length == 1) grouped[g++] = stripped[s++] = '5';
+            grouped[g] = stripped[s] = '\0';
+            double parsed = 0, expected = strtod(stripped, NULL);
+            const char* end = NULL;
+            if(rdouble_ex(grouped, &parsed).status || parsed != expected) ++failures;
+            if(_rdouble_n(grouped, g, &end) != expected || end != grouped + g) ++failures;
+        }
+        total_tests++;
+        if(!failures) {
+            passed_tests++;
+            printf("[PASS] digit runs of 1 to 200 digits\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] %d digit runs parsed wrong\n", failures);
+        }
+
+        // a number ending right before an unmapped page is never read past
+        long page = sysconf(_SC_PAGESIZE);
+        char* pages = mmap(NULL, 2*page, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        total_tests++;
+        if(pages != MAP_FAILED && !mprotect(pages + page, page, PROT_NONE)) {
+            char* number = pages + page - 101;
+            memset(number, '7', 100);
+            number[50] = '.';
+            number[100] = '\0';
+            double nul = 0;
+            rdouble_ex(number, &nul);
+            double bounded = _rdouble_n(number + 1, 100, NULL);
+            if(nul == strtod(number, NULL) && bounded == strtod(number + 1, NULL)) {
+                passed_tests++;
+                printf("[PASS] digit runs stop at the end of the page\n");
+            } else {
+                failed_tests++;
+                printf("[FAIL] digit runs at the end of the page: %g %g\n", nul, bounded);
+            }
+        } else {
+            failed_tests++;
+            printf("[FAIL] could not map a guard page\n");
+        }
+        if(pages != MAP_FAILED) munmap(pages, 2*page);
+    }
+
+    printf("\n==== STREAMING ====\n");
+    {
+        static const struct {
+            const char* input;
+            enum rtype type;
+            char delimiter;
+            field_parser parse;
+            size_t size;
+        } cases[] = {
+            {"18,446,744,073;18_446_744_073_709_551_615;  42 ;0x1F_FF;0b;1e3;-5;18446744073709551616;;", RTYPE_ULONGLONG, ';', field_ulonglong, sizeof(unsigned long long)},
+            {"1 000 000\n-2_147_483_648\r\n12a\n1_000,0\n1 000\t0\n\r\n  7  \n1.5\n0o17\n0x\n", RTYPE_INT, '\n', field_int, sizeof(int)},
+            {"-128|127|128|--1|1-|0|00|0_0|-0x7F", RTYPE_SCHAR, '|', field_schar, sizeof(signed char)},
+            {"6.022_140_76e+23;-1 234.5e-3  ;.5;1.2.3;1e;1e5.0;0.000_000_1;2.5e-324;1e309;42;1,234,567.890_123", RTYPE_DOUBLE, ';', field_double, sizeof(double)},
+            {"3.402_823_5e38;3.402_823_7e38;1.5;-0.0", RTYPE_FLOAT, ';', field_float, sizeof(float)},
+        };
+        for(size_t c = 0; c < sizeof(cases)/sizeof(cases[0]); ++c) {
+            struct streamed expected;
+            expect_fields(cases[c].input, cases[c].delimiter, cases[c].parse, cases[c].size, &expected);
+            total_tests++;
+            if(stream_splits(cases[c].input, cases[c].type, cases[c].delimiter, &expected)) {
+                passed_tests++;
+                printf("[PASS] stream %zu: %zu numbers split at every byte\n", c, expected.count);
+            } else {
+                failed_tests++;
+                printf("[FAIL] stream %zu: %zu numbers split at every byte\n", c, expected.count);
+            }
+        }
+
+        // random numbers, split at every point, must come out like r*_ex()
+        static const char alphabet[] = "0123456789000111_,_ .e-+E\t5x0bo-;;\r";
+        int mismatches = 0;
+        srand(20);
+        for(int i = 0; i < 3000; ++i) {
+            char input[64];
+            int len = rand() % 40;
+            for(int j = 0; j < len; ++j) input[j] = alphabet[rand() % (sizeof(alphabet) - 1)];
+            input[len] = '\0';
+            struct streamed expected;
+            int ok = i % 2
+                ? (expect_fields(input, ';', field_double, sizeof(double), &expected), stream_splits(input, RTYPE_DOUBLE, ';', &expected))
+                : (expect_fields(input, ';', field_ulonglong, sizeof(unsigned long long), &expected), stream_splits(input, RTYPE_ULONGLONG, ';', &expected));
+            if(!ok && mismatches++ < 5) printf("       mismatch on \"%s\"\n", input);
+        }
+        total_tests++;
+        if(!mismatches) {
+            passed_tests++;
+            printf("[PASS] 3000 random streams split at every point parse like r*_ex\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] %d of 3000 random streams split at every point parse unlike r*_ex\n", mismatches);
+        }
+
+        // a number longer than any chunk, fed a byte at a time
+        struct streamed streamed = {0};
+        streamed.size = sizeof(double);
+        rstream_t stream;
+        rstream_init(&stream, RTYPE_DOUBLE, '\n', collect_number, &streamed);
+        size_t completed = 0;
+        for(int i = 0; i < 2000; ++i) completed += rstream_feed(&stream, i ? "0" : "1.", i ? 1 : 2);
+        completed += rstream_feed(&stream, "1\n", 2);
+        double value;
+        memcpy(&value, streamed.values[0].bytes, sizeof(value));
+        total_tests++;
+        if(completed == 1 && !rstream_finish(&stream) && !streamed.results[0].status && value == 1.0) {
+            passed_tests++;
+            printf("[PASS] 2003-byte number fed a byte at a time\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] 2003-byte number fed a byte at a time: %.17g\n", value);
+        }
+
+        total_tests++;
+        if(rstream_init(&stream, RTYPE_INT, '.', collect_number, &streamed) == RSTATUS_INVALID_ARGUMENT &&
+           rstream_init(&stream, RTYPE_INT, ',', collect_number, &streamed) == RSTATUS_INVALID_ARGUMENT &&
+           rstream_init(&stream, RTYPE_SKIP, ';', collect_number, &streamed) == RSTATUS_INVALID_ARGUMENT &&
+           rstream_init(&stream, RTYPE_INT, '\0', collect_number, &streamed) == RSTATUS_OK) {
+            passed_tests++;
+            printf("[PASS] rstream_init() rejects bad delimiters and types\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rstream_init() rejects bad delimiters and types\n");
+        }
+    }
+
+    printf("\n==== FIXED POINT ====\n");
+    {
+        int64_t cents;
+        ASSERT_RESULT(rdecimal_i64("1,234,567.89", 2, RROUND_EXACT, &cents), cents, 123456789, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("-1 234.5", 2, RROUND_EXACT, &cents), cents, -123450, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("12", 3, RROUND_EXACT, &cents), cents, 12000, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("1.5e3", 2, RROUND_EXACT, &cents), cents, 150000, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("1e-2", 2, RROUND_EXACT, &cents), cents, 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("1.230", 2, RROUND_EXACT, &cents), cents, 123, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("0.000", 2, RROUND_EXACT, &cents), cents, 0, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("0x7F_FF", 2, RROUND_EXACT, &cents), cents, 3276700, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("1.005", 2, RROUND_EXACT, &cents), cents, 0, RSTATUS_INEXACT, 0);
+        ASSERT_RESULT(rdecimal_i64("1.005", 2, RROUND_HALF_EVEN, &cents), cents, 100, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("1.015", 2, RROUND_HALF_EVEN, &cents), cents, 102, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("1.005_000_000_000_000_000_000_1", 2, RROUND_HALF_EVEN, &cents), cents, 101, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("1.005", 2, RROUND_HALF_AWAY, &cents), cents, 101, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("-1.005", 2, RROUND_HALF_AWAY, &cents), cents, -101, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("1.009", 2, RROUND_TOWARD_ZERO, &cents), cents, 100, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("-1.009", 2, RROUND_TOWARD_ZERO, &cents), cents, -100, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("-1.001", 2, RROUND_FLOOR, &cents), cents, -101, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("1.001", 2, RROUND_CEILING, &cents), cents, 101, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("0.000_000_1", 2, RROUND_CEILING, &cents), cents, 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("-0.000_000_1", 2, RROUND_CEILING, &cents), cents, 0, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("0.5e-300", 2, RROUND_FLOOR, &cents), cents, 0, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("9,223,372,036,854,775,807", 0, RROUND_EXACT, &cents), cents, INT64_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("-92,233,720,368,547,758.08", 2, RROUND_EXACT, &cents), cents, INT64_MIN, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("92,233,720,368,547,758.08", 2, RROUND_EXACT, &cents), cents, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rdecimal_i64("-92,233,720,368,547,758.09", 2, RROUND_EXACT, &cents), cents, 0, RSTATUS_UNDERFLOW, 0);
+        ASSERT_RESULT(rdecimal_i64("9223372036854775807.5", 0, RROUND_HALF_EVEN, &cents), cents, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rdecimal_i64("9223372036854775807.5", 0, RROUND_TOWARD_ZERO, &cents), cents, INT64_MAX, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i64("18446744073709551615.5", 0, RROUND_CEILING, &cents), cents, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rdecimal_i64("1e300", 0, RROUND_EXACT, &cents), cents, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rdecimal_i64("0x1", 19, RROUND_EXACT, &cents), cents, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rdecimal_i64("1_000,5", 2, RROUND_EXACT, &cents), cents, 0, RSTATUS_SEPARATOR_MISMATCH, 5);
+        ASSERT_RESULT(rdecimal_i64("", 2, RROUND_EXACT, &cents), cents, 0, RSTATUS_EMPTY, 0);
+        ASSERT_RESULT(rdecimal_i64("1.005", 2, (enum rrounding)99, &cents), cents, 0, RSTATUS_INVALID_ARGUMENT, 0);
+        ASSERT_RESULT(rdecimal_i64("1", 2, (enum rrounding)-1, &cents), cents, 0, RSTATUS_INVALID_ARGUMENT, 0);
+#ifdef __SIZEOF_INT128__
+        __int128 wide;
+        const __int128 i128_max = (__int128)(~(unsigned __int128)0 >> 1);
+        ASSERT_RESULT(rdecimal_i128("170,141,183,460,469,231,731,687,303,715,884,105,727", 0, RROUND_EXACT, &wide), wide, i128_max, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i128("-17,014,118,346,046,923,173,168,730,371,588,410,572.8", 1, RROUND_EXACT, &wide), wide, -i128_max - 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i128("170,141,183,460,469,231,731,687,303,715,884,105,727.5", 0, RROUND_HALF_EVEN, &wide), wide, 0, RSTATUS_OVERFLOW, 0);
+        ASSERT_RESULT(rdecimal_i128("1,234,567.8915", 3, RROUND_HALF_EVEN, &wide), wide, 1234567892, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i128("-1e30", 6, RROUND_EXACT, &wide), wide, -(__int128)1000000000000000000ULL*1000000000000000000ULL, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i128("0xFFFF_FFFF_FFFF_FFFF", 2, RROUND_EXACT, &wide), wide, (__int128)UINT64_MAX*100, RSTATUS_OK, 0);
+        ASSERT_RESULT(rdecimal_i128("1.005", 2, (enum rrounding)99, &wide), wide, 0, RSTATUS_INVALID_ARGUMENT, 0);
+#endif
+
+        // random amounts against integer arithmetic on the same digits
+        static const unsigned long long powers[] = {1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000};
+        int mismatches = 0;
+        srand(21);
+        for(int i = 0; i < 100000; ++i) {
+            unsigned long long integer = ((unsigned long long)rand() << 31 | (unsigned long long)rand()) % 10000000000ULL;
+            int fraction_digits = rand() % 9, scale = rand() % 9, negative = rand() % 2;
+            enum rrounding rounding = (enum rrounding)(1 + rand() % 5);
+            unsigned long long fraction = (unsigned long long)rand() % powers[fraction_digits];
+            char input[64];
+            if(fraction_digits) snprintf(input, sizeof(input), "%s%llu.%0*llu", negative ? "-" : "", integer, fraction_digits, fraction);
+            else snprintf(input, sizeof(input), "%s%llu", negative ? "-" : "", integer);
+
+            unsigned long long whole = integer*powers[fraction_digits] + fraction, magnitude;
+            if(scale >= fraction_digits) magnitude = whole*powers[scale - fraction_digits];
+            else {
+                unsigned long long divisor = powers[fraction_digits - scale];
+                magnitude = round_reference(whole/divisor, whole%divisor, divisor, negative, rounding);
+            }
+            int64_t expected = negative ? -(int64_t)magnitude : (int64_t)magnitude;
+            struct rresult result = rdecimal_i64(input, (unsigned)scale, rounding, &cents);
+            if(result.status || cents != expected) {
+                if(mismatches++ < 5) printf("       mismatch on \"%s\" at scale %d, mode %d: %lld\n", input, scale, rounding, (long long)cents);
+            }
+        }
+        total_tests++;
+        if(!mismatches) {
+            passed_tests++;
+            printf("[PASS] 100000 random amounts scaled and rounded exactly\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] %d of 100000 random amounts scaled or rounded wrong\n", mismatches);
+        }
+
+        // the one-loop path for plain amounts against the full scanner, which
+        // trailing whitespace (ignored) always sends the number through
+        static const char alphabet[] = "0123456789000999555_,_.-e";
+        mismatches = 0;
+        for(int i = 0; i < 200000; ++i) {
+            char input[64], padded[sizeof(input) + 1];
+            int len = rand() % 26;
+            for(int j = 0; j < len; ++j) input[j] = alphabet[rand() % (sizeof(alphabet) - 1)];
+            input[len] = '\0';
+            snprintf(padded, sizeof(padded), "%s ", input);
+            unsigned scale = (unsigned)(rand() % 22);
+            enum rrounding rounding = (enum rrounding)(rand() % 6);
+            int64_t fast, full;
+            struct rresult a = rdecimal_i64(input, scale, rounding, &fast), b = rdecimal_i64(padded, scale, rounding, &full);
+            if(a.status != b.status || a.offset != b.offset || fast != full) {
+                if(mismatches++ < 5) printf("       mismatch on \"%s\" at scale %u, mode %d\n", input, scale, rounding);
+            }
+        }
+        total_tests++;
+        if(!mismatches) {
+            passed_tests++;
+            printf("[PASS] 200000 random inputs agree with and without the fast path\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] %d of 200000 random inputs differ with and without the fast path\n", mismatches);
+        }
+    }
+
+    printf("\n==== BIG INTEGERS ====\n");
+    {
+        uint64_t workspace[64];
+        struct rbig big;
+        const char* two_128 = "-340,282,366,920,938,463,463,374,607,431,768,211,456";
+        ASSERT_RESULT(rbig_ex(two_128, strlen(two_128), workspace, 64, &big), (big.count == 3 && !big.limbs[0] && !big.limbs[1] && big.limbs[2] == 1 && big.negative), 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rbig_ex("18_446_744_073_709_551_615", 26, workspace, 64, &big), (big.count == 1 && big.limbs[0] == UINT64_MAX && !big.negative), 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rbig_ex("0xFFFF_FFFF_FFFF_FFFF_0000_0000_0000_0001", 41, workspace, 64, &big), (big.count == 2 && big.limbs[0] == 1 && big.limbs[1] == UINT64_MAX), 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rbig_ex("0o2_000_000_000_000_000_000_000", 31, workspace, 64, &big), (big.count == 2 && !big.limbs[0] && big.limbs[1] == 1), 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rbig_ex("0b1_0000000000000000000000000000000000000000000000000000000000000000", 68, workspace, 64, &big), (big.count == 2 && !big.limbs[0] && big.limbs[1] == 1), 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rbig_ex("000_000_012", 11, workspace, 64, &big), (big.count == 1 && big.limbs[0] == 12), 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rbig_ex("-0", 2, workspace, 64, &big), (big.count == 0 && !big.negative), 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rbig_ex("12345;", 5, workspace, 64, &big), (big.count == 1 && big.limbs[0] == 12345), 1, RSTATUS_OK, 0);
+        ASSERT_RESULT(rbig_ex("1_000.5", 7, workspace, 64, &big), big.count, 0, RSTATUS_FLOAT_TO_INTEGER, 0);
+        ASSERT_RESULT(rbig_ex("1_000,000", 9, workspace, 64, &big), big.count, 0, RSTATUS_SEPARATOR_MISMATCH, 5);
+        ASSERT_RESULT(rbig_ex("", 0, workspace, 64, &big), big.count, 0, RSTATUS_EMPTY, 0);
+        ASSERT_RESULT(rbig_ex(two_128, strlen(two_128), workspace, 2, &big), big.count, 0, RSTATUS_OVERFLOW, 0);
+
+        // the arena keeps the limbs of each number and nothing else
+        uint64_t memory[128];
+        struct rarena arena = {memory, sizeof(memory), 3};
+        struct rbig first, second;
+        ASSERT_RESULT(rbig_arena_ex(two_128, strlen(two_128), &arena, &first), arena.used, 8 + 3*sizeof(uint64_t), RSTATUS_OK, 0);
+        ASSERT_RESULT(rbig_arena_ex("0xABC", 5, &arena, &second), (arena.used == 8 + 4*sizeof(uint64_t) && second.limbs[0] == 0xABC && first.limbs[2] == 1), 1, RSTATUS_OK, 0);
+        arena.size = arena.used + 16;
+        ASSERT_RESULT(rbig_arena_ex(two_128, strlen(two_128), &arena, &second), arena.used, 8 + 4*sizeof(uint64_t), RSTATUS_OVERFLOW, 0);
+
+        // random limbs written in decimal by schoolbook division, grouped or
+        // not, and in hexadecimal, read back in exactly rbig_workspace()
+        // limbs: sizes on both sides of the schoolbook and Karatsuba cutoffs
+        static const size_t sizes[] = {1, 2, 3, 5, 19, 20, 33, 60, 64, 65, 66, 100, 127, 128, 129, 300, 1000, 2500};
+        const char separators[] = {0, '_', ',', ' '};
+        int mismatches = 0;
+        srand(25);
+        for(size_t s = 0; s < sizeof(sizes)/sizeof(sizes[0]); ++s) {
+            size_t count = sizes[s];
+            uint64_t* limbs = malloc(count*sizeof(uint64_t));
+            uint64_t* copy = malloc(count*sizeof(uint64_t));
+            char* digits = malloc(count*20 + 16);
+            char* text = malloc(count*27 + 16);
+            for(size_t i = 0; i < count; ++i) {
+                limbs[i] = (uint64_t)rand() << 42 ^ (uint64_t)rand() << 21 ^ (uint64_t)rand();
+                // runs of zero or all-one limbs now and then
+                if(rand() % 8 == 0) limbs[i] = rand() % 2 ? UINT64_MAX : 0;
+            }
+            if(!limbs[count - 1]) limbs[count - 1] = 1;
+
+            for(int form = 0; form < 5; ++form) {
+                char separator = separators[form % 4];
+                int negative = form % 2;
+                char* p = text;
+                if(negative) *p++ = '-';
+                size_t length;
+                if(form < 4) {
+                    memcpy(copy, limbs, count*sizeof(uint64_t));
+                    length = limbs_to_decimal(copy, count, digits);
+                    for(size_t i = 0; i < length; ++i) {
+                        if(separator && i && (length - i) % 3 == 0) *p++ = separator;
+                        *p++ = digits[i];
+                    }
+                } else {
+                    p += sprintf(p, "0x%llx", (unsigned long long)limbs[count - 1]);
+                    for(size_t i = count - 1; i--;) p += sprintf(p, "_%016llx", (unsigned long long)limbs[i]);
+                }
+                *p = '\0';
+
+                length = (size_t)(p - text);
+                size_t size = rbig_workspace(length);
+                uint64_t* space = malloc(size*sizeof(uint64_t));
+                struct rresult result = rbig_ex(text, length, space, size, &big);
+                if(result.status || big.count != count || big.negative != negative || memcmp(big.limbs, limbs, count*sizeof(uint64_t))) {
+                    if(mismatches++ < 5) printf("       mismatch on %zu limbs in form %d: status %d, %zu limbs\n", count, form, result.status, big.count);
+                }
+                free(space);
+            }
+            free(limbs);
+            free(copy);
+            free(digits);
+            free(text);
+        }
+        total_tests++;
+        if(!mismatches) {
+            passed_tests++;
+            printf("[PASS] rbig_ex reads back random numbers of 1 to 2500 limbs\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] %d random numbers read back wrong by rbig_ex\n", mismatches);
+        }
+    }
+
+    printf("\n==== ERROR HANDLER ====\n");
+    {
+        struct captured_errors captured = {0};
+        rset_error_handler(capture_error, &captured, 0);
+        _rint("12a34");
+        _rulong("-5");
+        total_tests++;
+        if(captured.count == 2 && captured.last == RSTATUS_NEGATIVE_UNSIGNED &&
+           !strcmp(captured.first_message, "[CREADABLE ERROR] Invalid symbol found: 'a'. Defaulting to zero.")) {
+            passed_tests++;
+            printf("[PASS] errors go to the installed handler\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] errors go to the installed handler: %d call(s)\n", captured.count);
+        }
+
+        // the budget may straddle a second boundary, hence up to twice the limit
+        captured = (struct captured_errors){0};
+        rset_error_handler(capture_error, &captured, 3);
+        for(int i = 0; i < 1000; ++i) _rint("x");
+        total_tests++;
+        if(captured.count >= 3 && captured.count <= 6) {
+            passed_tests++;
+            printf("[PASS] errors are rate limited\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] errors are rate limited: %d call(s)\n", captured.count);
+        }
+
+        struct rresult result;
+        int value;
+        captured = (struct captured_errors){0};
+        rset_error_handler(capture_error, &captured, 0);
+        result = rint_ex("12a34", &value);
+        total_tests++;
+        if(captured.count == 0 && result.status == RSTATUS_INVALID_SYMBOL) {
+            passed_tests++;
+            printf("[PASS] r*_ex() never reports\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] r*_ex() never reports\n");
+        }
+        rset_error_handler(NULL, NULL, 0);
+    }
+
+    printf("\n==== FORMATTING ====\n");
+    {
+        char buffer[32];
+        ASSERT_FORMAT(rformat_int(1234567, '_', buffer, sizeof(buffer)), buffer, "1_234_567");
+        ASSERT_FORMAT(rformat_int(INT_MIN, ',', buffer, sizeof(buffer)), buffer, "-2,147,483,648");
+        ASSERT_FORMAT(rformat_int(0, '_', buffer, sizeof(buffer)), buffer, "0");
+        ASSERT_FORMAT(rformat_int(-999, ',', buffer, sizeof(buffer)), buffer, "-999");
+        ASSERT_FORMAT(rformat_int(-1000, ' ', buffer, sizeof(buffer)), buffer, "-1 000");
+        ASSERT_FORMAT(rformat_int(123456, 0, buffer, sizeof(buffer)), buffer, "123456");
+        ASSERT_FORMAT(rformat_schar(SCHAR_MIN, '_', buffer, sizeof(buffer)), buffer, "-128");
+        ASSERT_FORMAT(rformat_uchar(UCHAR_MAX, '_', buffer, sizeof(buffer)), buffer, "255");
+        ASSERT_FORMAT(rformat_short(SHRT_MIN, ',', buffer, sizeof(buffer)), buffer, "-32,768");
+        ASSERT_FORMAT(rformat_ushort(USHRT_MAX, ' ', buffer, sizeof(buffer)), buffer, "65 535");
+        ASSERT_FORMAT(rformat_uint(UINT_MAX, '_', buffer, sizeof(buffer)), buffer, "4_294_967_295");
+        ASSERT_FORMAT(rformat_longlong(LLONG_MIN, ',', buffer, sizeof(buffer)), buffer, "-9,223,372,036,854,775,808");
+        ASSERT_FORMAT(rformat_longlong(LLONG_MAX, 0, buffer, sizeof(buffer)), buffer, "9223372036854775807");
+        ASSERT_FORMAT(rformat_ulonglong(ULLONG_MAX, '_', buffer, sizeof(buffer)), buffer, "18_446_744_073_709_551_615");
+        ASSERT_FORMAT(rformat_ulonglong(10000000000000000000ULL, ',', buffer, sizeof(buffer)), buffer, "10,000,000,000,000,000,000");
+
+        // too small: the length is still returned
+        total_tests++;
+        if(rformat_int(1234567, '_', buffer, 9) == 9 && buffer[0] == '\0' && rformat_int(1234567, '_', buffer, 10) == 9) {
+            passed_tests++;
+            printf("[PASS] rformat_int into a buffer one byte short\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rformat_int into a buffer one byte short\n");
+        }
+
+        // a separator the parsers would not read back
+        struct captured_errors captured = {0};
+        rset_error_handler(capture_error, &captured, 0);
+        strcpy(buffer, "untouched");
+        size_t rejected = rformat_int(1234567, '.', buffer, sizeof(buffer));
+        rejected += rformat_ulonglong(1, '\t', buffer, sizeof(buffer));
+        rejected += rformat_double(1.5, 'x', buffer, sizeof(buffer));
+        rejected += rformat_float(NAN, '-', buffer, sizeof(buffer));
+        rset_error_handler(NULL, NULL, 0);
+        total_tests++;
+        if(rejected == 0 && buffer[0] == '\0' && captured.count == 4 && captured.last == RSTATUS_INVALID_ARGUMENT &&
+           strstr(captured.first_message, "'.' cannot be used as separator.")) {
+            passed_tests++;
+            printf("[PASS] rformat_* rejects invalid separators\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rformat_* rejects invalid separators: %d report(s)\n", captured.count);
+        }
+
+        // every power of ten and its neighbours, then random values, through
+        // each separator and back
+        const char separators[] = {'_', ',', ' ', 0};
+        int round_trip_failures = 0;
+        unsigned long long value = 1;
+        srand(2024);
+        for(int i = 0; i < 100000; ++i) {
+            if(i < 20*3) {
+                unsigned long long power = 1;
+                for(int k = 0; k < i/3; ++k) power *= 10;
+                value = power + (unsigned long long)(i % 3) - 1;
+            } else {
+                value = (unsigned long long)rand() << 42 ^ (unsigned long long)rand() << 21 ^ (unsigned long long)rand();
+                value >>= rand() % 64;
+            }
+            char separator = separators[i % 4];
+            size_t length = rformat_ulonglong(value, separator, buffer, sizeof(buffer));
+            char expected[32];
+            snprintf(expected, sizeof(expected), "%llu", value);
+            if(length != strlen(buffer) || _rulonglong(buffer) != value) ++round_trip_failures;
+            rformat_longlong(-(long long)(value >> 1), separator, buffer, sizeof(buffer));
+            if(_rlonglong(buffer) != -(long long)(value >> 1)) ++round_trip_failures;
+            if(!separator && strcmp(expected, (rformat_ulonglong(value, 0, buffer, sizeof(buffer)), buffer))) ++round_trip_failures;
+        }
+        total_tests++;
+        if(!round_trip_failures) {
+            passed_tests++;
+            printf("[PASS] rformat round-trips through _rulonglong/_rlonglong (100000 values)\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rformat round-trips: %d failures\n", round_trip_failures);
+        }
+
+        // floating point: the shortest digits, always with a decimal point
+        ASSERT_FORMAT(rformat_double(1234567.125, '_', buffer, sizeof(buffer)), buffer, "1_234_567.125");
+        ASSERT_FORMAT(rformat_double(0.1, '_', buffer, sizeof(buffer)), buffer, "0.1");
+        ASSERT_FORMAT(rformat_double(100.0, ',', buffer, sizeof(buffer)), buffer, "100.0");
+        ASSERT_FORMAT(rformat_double(-1000.5, ' ', buffer, sizeof(buffer)), buffer, "-1 000.5");
+        ASSERT_FORMAT(rformat_double(0.0, '_', buffer, sizeof(buffer)), buffer, "0.0");
+        ASSERT_FORMAT(rformat_double(-0.0, '_', buffer, sizeof(buffer)), buffer, "-0.0");
+        ASSERT_FORMAT(rformat_double(1e20, '_', buffer, sizeof(buffer)), buffer, "100_000_000_000_000_000_000.0");
+        ASSERT_FORMAT(rformat_double(1e21, '_', buffer, sizeof(buffer)), buffer, "1.0e21");
+        ASSERT_FORMAT(rformat_double(0.000001, '_', buffer, sizeof(buffer)), buffer, "0.000001");
+        ASSERT_FORMAT(rformat_double(1.5e-7, '_', buffer, sizeof(buffer)), buffer, "1.5e-7");
+        ASSERT_FORMAT(rformat_double(DBL_MAX, '_', buffer, sizeof(buffer)), buffer, "1.7976931348623157e308");
+        ASSERT_FORMAT(rformat_double(DBL_MIN, '_', buffer, sizeof(buffer)), buffer, "2.2250738585072014e-308");
+        ASSERT_FORMAT(rformat_double(4.9406564584124654e-324, '_', buffer, sizeof(buffer)), buffer, "5.0e-324");
+        ASSERT_FORMAT(rformat_double(9007199254740993.0, 0, buffer, sizeof(buffer)), buffer, "9007199254740992.0");
+        ASSERT_FORMAT(rformat_double(INFINITY, '_', buffer, sizeof(buffer)), buffer, "inf");
+        ASSERT_FORMAT(rformat_double(-INFINITY, '_', buffer, sizeof(buffer)), buffer, "-inf");
+        ASSERT_FORMAT(rformat_double(NAN, '_', buffer, sizeof(buffer)), buffer, "nan");
+        ASSERT_FORMAT(rformat_float(0.1f, '_', buffer, sizeof(buffer)), buffer, "0.1");
+        ASSERT_FORMAT(rformat_float(16777216.0f, ',', buffer, sizeof(buffer)), buffer, "16,777,216.0");
+        ASSERT_FORMAT(rformat_float(FLT_MAX, '_', buffer, sizeof(buffer)), buffer, "3.4028235e38");
+        ASSERT_FORMAT(rformat_float(FLT_MIN, '_', buffer, sizeof(buffer)), buffer, "1.1754944e-38");
+        ASSERT_FORMAT(rformat_float(1.4e-45f, '_', buffer, sizeof(buffer)), buffer, "1.0e-45");
+
+        total_tests++;
+        if(rformat_double(0.125, '_', buffer, 5) == 5 && buffer[0] == '\0' && rformat_double(0.125, '_', buffer, 6) == 5) {
+            passed_tests++;
+            printf("[PASS] rformat_double into a buffer one byte short\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rformat_double into a buffer one byte short\n");
+        }
+
+        // every power of two and its neighbours, where the interval rounding
+        // to a value is lopsided, then random bit patterns: the text reads
+        // back to the same bits and has no more digits than the shortest
+        // %.*e that strtod/strtof read back
+        int float_failures = 0;
+        uint64_t state = 0x9E3779B97F4A7C15ULL;
+        for(int i = 0; i < 200000; ++i) {
+            uint64_t bits;
+            if(i < 2046*3) {
+                bits = ((uint64_t)(i/3 + 1) << 52) + (uint64_t)(i % 3) - 1;
+            } else {
+                state ^= state << 13;
+                state ^= state >> 7;
+                state ^= state << 17;
+                bits = state;
+            }
+            char separator = separators[i % 4];
+            char expected[48];
+
+            double d, d_back;
+            memcpy(&d, &bits, sizeof(d));
+            if(isfinite(d)) {
+                size_t length = rformat_double(d, separator, buffer, sizeof(buffer));
+                if(length != strlen(buffer) || !strchr(buffer, '.') || rdouble_ex(buffer, &d_back).status || memcmp(&d, &d_back, sizeof(d))) ++float_failures;
+                int precision = 0;
+                while(snprintf(expected, sizeof(expected), "%.*e", precision, d), strtod(expected, NULL) != d) ++precision;
+                if(d != 0 && significant_digits(buffer) > precision + 1) ++float_failures;
+            }
+
+            uint32_t bits32 = i < 254*3 ? ((uint32_t)(i/3 + 1) << 23) + (uint32_t)(i % 3) - 1 : (uint32_t)(bits >> 32);
+            float f, f_back;
+            memcpy(&f, &bits32, sizeof(f));
+            if(isfinite(f)) {
+                rformat_float(f, separator, buffer, sizeof(buffer));
+                if(!strchr(buffer, '.') || rfloat_ex(buffer, &f_back).status || memcmp(&f, &f_back, sizeof(f))) ++float_failures;
+                int precision = 0;
+                while(snprintf(expected, sizeof(expected), "%.*e", precision, f), strtof(expected, NULL) != f) ++precision;
+                if(f != 0 && significant_digits(buffer) > precision + 1) ++float_failures;
+            }
+        }
+        total_tests++;
+        if(!float_failures) {
+            passed_tests++;
+            printf("[PASS] rformat_double/rformat_float round-trip with the fewest digits (200000 values each)\n");
+        } else {
+            failed_tests++;
+            printf("[FAIL] rformat_double/rformat_float round-trips: %d failures\n", float_failures);
+        }
+    }
+
+    printf("\n==== ALLOCATIONS ====\n");
+    ASSERT_NO_ALLOC(_rint("1_234_567"));
+    ASSERT_NO_ALLOC(_rulonglong("18,446,744,073,709,551,615"));
+    ASSERT_NO_ALLOC(_rdouble("-1 234.567 89"));
+    ASSERT_NO_ALLOC(_rlongdouble("0.000_000_1"));
+    ASSERT_NO_ALLOC(_rint("999999999999999"));
+    ASSERT_NO_ALLOC(_rlong("-99999999999999999999999"));
+    ASSERT_NO_ALLOC(_rchar("12.5"));
+    ASSERT_NO_ALLOC(_rushort("-1"));
+    ASSERT_NO_ALLOC(_rfloat("1_2,3.0"));
+    ASSERT_NO_ALLOC(_rint("12a34"));
+    ASSERT_NO_ALLOC(_rint_n("1_234;", 6, NULL));
+    ASSERT_NO_ALLOC(_rdouble_n("-1 234.5e3 x", 12, NULL));
+    ASSERT_NO_ALLOC(_rulonglong("0xFFFF_FFFF_0000_0000"));
+    ASSERT_NO_ALLOC(rvalidate("-1_234.5e6", 10));
+    {
+        struct rparser european;
+        double value;
+        rparser_init(&european, ".", ',', 0);
+        ASSERT_NO_ALLOC(rdouble_ex_with("1.234.567,89", &value, &european));
+    }
+    {
+        char buffer[32];
+        ASSERT_NO_ALLOC(rformat_ulonglong(ULLONG_MAX, ',', buffer, sizeof(buffer)));
+    }
+    {
+        // long enough for the divide and conquer conversion and its scratch space
+        static char digits[3000];
+        static uint64_t workspace[4096];
+        struct rbig big;
+        memset(digits, '7', sizeof(digits));
+        ASSERT_NO_ALLOC(rbig_ex(digits, sizeof(digits), workspace, rbig_workspace(sizeof(digits)), &big));
+    }
+
+    printf("\n==== PER-CALL-SITE CACHE ====\n");
+    static char cached_literal[] = "1_234_567";
+    ASSERT_EQ_INT(_rint_cached, cached_literal, 1234567);
+    ASSERT_EQ_INT(_rint_cached, cached_literal, 1234567);
+    ASSERT_EQ_UINT(_ruint_cached, cached_literal, 1234567);
+    ASSERT_EQ_DOUBLE(_rdouble_cached, "-12.5", -12.5);
+    ASSERT_EQ_INT(_rint_cached, "12a34", 0);
+    ASSERT_EQ_INT(_rint_cached, "12a34", 0);
+    ASSERT_NO_ALLOC(_rlonglong_cached("9_223_372_036_854_775_807"));
+
     printf("\n==== SUMMARY ====\n");
     printf("Total: %d | Passed: %d | Failed: %d\n",
            total_tests, passed_tests, failed_tests);
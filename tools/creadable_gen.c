@@ -0,0 +1,506 @@
+// creadable_gen: turns the r*() literals of C sources into constants at
+// build time.
+//
+//   creadable_gen -o <generated.h> <source.c>...
+//
+// Every r<type>(...) call site in the sources is parsed with the library
+// itself. An invalid or out of range literal is reported as
+// file:line:column and the tool fails without writing anything. Otherwise
+// the generated header redefines the macros that were used so that each
+// literal it has seen expands to a constant; any other literal (from a
+// header that was not scanned, say) still goes to the runtime parser.
+// Compile the sources with -include <generated.h>.
+//
+// Each call site pastes its __LINE__ into the name of a macro that only
+// compares the stringified literal, with __builtin_strcmp, against the
+// literals seen on that line, so a site costs the same however many there
+// are. GCC and Clang fold the comparison even without optimisations, so the
+// result can also initialise static variables. Literals in the body of a
+// #define expand on other lines and are compared on every line instead.
+// rparse() is left alone.
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <limits.h>
+#include <stdint.h>
+
+#include "../src/creadable.h"
+
+// ===========================
+// Literal types
+// ===========================
+
+// Parses literal and writes the C constant it stands for.
+typedef struct rresult (*constant_writer)(const char* literal, char* constant, size_t size);
+
+#define SIGNED(name, type) \
+	static struct rresult constant_##name(const char* literal, char* constant, size_t size) { \
+		type value; \
+		struct rresult result = r##name##_ex(literal, &value); \
+		long long wide = value; \
+		if(wide == LLONG_MIN) snprintf(constant, size, "((" #type ")(-%lldLL - 1))", LLONG_MAX); \
+		else snprintf(constant, size, "((" #type ")(%lldLL))", wide); \
+		return result; \
+	}
+
+#define UNSIGNED(name, type) \
+	static struct rresult constant_##name(const char* literal, char* constant, size_t size) { \
+		type value; \
+		struct rresult result = r##name##_ex(literal, &value); \
+		snprintf(constant, size, "((" #type ")%lluULL)", (unsigned long long)value); \
+		return result; \
+	}
+
+// hexadecimal floating point constants are exact; there is no literal for
+// infinity, so a value out of the type's range is an overflow
+#define FLOATING(name, type, format, suffix) \
+	static struct rresult constant_##name(const char* literal, char* constant, size_t size) { \
+		type value; \
+		struct rresult result = r##name##_ex(literal, &value); \
+		if(!result.status && value - value != 0) result.status = RSTATUS_OVERFLOW; \
+		snprintf(constant, size, "((" #type ")" format suffix ")", value); \
+		return result; \
+	}
+
+SIGNED(char, char)
+SIGNED(schar, signed char)
+UNSIGNED(uchar, unsigned char)
+
+SIGNED(short, short)
+UNSIGNED(ushort, unsigned short)
+
+SIGNED(int, int)
+UNSIGNED(uint, unsigned int)
+
+SIGNED(long, long)
+SIGNED(longlong, long long)
+UNSIGNED(ulong, unsigned long)
+UNSIGNED(ulonglong, unsigned long long)
+
+FLOATING(float, float, "%a", "")
+
+FLOATING(double, double, "%a", "")
+FLOATING(longdouble, long double, "%La", "L")
+
+#ifdef __SIZEOF_INT128__
+// there are no 128-bit literals: the two halves are put back together
+static struct rresult constant_i128(const char* literal, char* constant, size_t size) {
+	__int128 value;
+	struct rresult result = ri128_ex(literal, &value);
+	unsigned __int128 bits = (unsigned __int128)value;
+	snprintf(constant, size, "((__int128)((unsigned __int128)0x%llxULL << 64 | 0x%llxULL))", (unsigned long long)(bits >> 64), (unsigned long long)bits);
+	return result;
+}
+
+static struct rresult constant_u128(const char* literal, char* constant, size_t size) {
+	unsigned __int128 value;
+	struct rresult result = ru128_ex(literal, &value);
+	snprintf(constant, size, "((unsigned __int128)0x%llxULL << 64 | 0x%llxULL)", (unsigned long long)(value >> 64), (unsigned long long)value);
+	return result;
+}
+#endif
+
+static const struct {
+	const char* macro;
+	const char* name; // of the _r<name>() runtime parser
+	const char* type;
+	constant_writer write;
+} types[] = {
+	{"rchar", "char", "char", constant_char},
+	{"rschar", "schar", "signed char", constant_schar},
+	{"ruchar", "uchar", "unsigned char", constant_uchar},
+	{"rshort", "short", "short", constant_short},
+	{"rushort", "ushort", "unsigned short", constant_ushort},
+	{"rint", "int", "int", constant_int},
+	{"ruint", "uint", "unsigned int", constant_uint},
+	{"rlong", "long", "long", constant_long},
+	{"rlonglong", "longlong", "long long", constant_longlong},
+	{"rulong", "ulong", "unsigned long", constant_ulong},
+	{"rulonglong", "ulonglong", "unsigned long long", constant_ulonglong},
+	{"rfloat", "float", "float", constant_float},
+	{"rdouble", "double", "double", constant_double},
+	{"rlongdouble", "longdouble", "long double", constant_longdouble},
+#ifdef __SIZEOF_INT128__
+	{"ri128", "i128", "__int128", constant_i128},
+	{"ru128", "u128", "unsigned __int128", constant_u128},
+#endif
+};
+
+#define NTYPES (sizeof(types)/sizeof(*types))
+
+static const char* const status_messages[RSTATUS_COUNT] = {
+	[RSTATUS_OK] = "ok",
+	[RSTATUS_EMPTY] = "no number provided",
+	[RSTATUS_INVALID_SYMBOL] = "invalid symbol",
+	[RSTATUS_SEPARATOR_MISMATCH] = "inconsistent separators",
+	[RSTATUS_MISPLACED_SYMBOL] = "misplaced symbol",
+	[RSTATUS_MISSING_EXPONENT] = "missing exponent",
+	[RSTATUS_OVERFLOW] = "overflows",
+	[RSTATUS_UNDERFLOW] = "underflows",
+	[RSTATUS_NEGATIVE_UNSIGNED] = "negative number for an unsigned type",
+	[RSTATUS_FLOAT_TO_INTEGER] = "floating point number for an integer type",
+	[RSTATUS_INTEGER_TO_FLOAT] = "integer number for a floating point type",
+	[RSTATUS_IO_ERROR] = "I/O error",
+	[RSTATUS_INVALID_ARGUMENT] = "invalid argument",
+	[RSTATUS_INEXACT] = "inexact",
+};
+
+// ===========================
+// Collected literals
+// ===========================
+struct literal {
+	size_t type;
+	char* text; // as #__VA_ARGS__ stringifies it
+	char* constant;
+	int anywhere; // seen in the body of a #define
+};
+
+static struct literal* literals = NULL;
+static size_t nliterals = 0;
+static size_t literals_size = 0;
+
+// One line a literal was seen on, in any of the sources. A call site
+// spanning lines is recorded on each, whichever __LINE__ the compiler gives.
+struct site {
+	size_t type;
+	int line;
+	size_t literal;
+};
+
+static struct site* sites = NULL;
+static size_t nsites = 0;
+static size_t sites_size = 0;
+
+static void* checked(void* p) {
+	if(!p) {
+		fprintf(stderr, "creadable_gen: out of memory\n");
+		exit(1);
+	}
+	return p;
+}
+
+static char* duplicate(const char* s) {
+	return strcpy(checked(malloc(strlen(s) + 1)), s);
+}
+
+static void add_site(size_t type, int line, size_t literal) {
+	if(nsites == sites_size) {
+		sites_size = sites_size ? 2*sites_size : 64;
+		sites = checked(realloc(sites, sites_size*sizeof(*sites)));
+	}
+	sites[nsites++] = (struct site){type, line, literal};
+}
+
+// Records the call site from line to last_line, or in a #define body if
+// last_line is 0. Returns 0 if the literal is invalid for its type, after
+// reporting it.
+static int add_literal(const char* path, int line, int column, int last_line, size_t type, const char* text) {
+	size_t literal = 0;
+	while(literal < nliterals && (literals[literal].type != type || strcmp(literals[literal].text, text))) ++literal;
+
+	if(literal == nliterals) {
+		char constant[128];
+		struct rresult result = types[type].write(text, constant, sizeof(constant));
+		if(result.status) {
+			fprintf(stderr, "%s:%d:%d: error: %s(%s): %s\n", path, line, column, types[type].macro, text, status_messages[result.status]);
+			return 0;
+		}
+
+		if(nliterals == literals_size) {
+			literals_size = literals_size ? 2*literals_size : 64;
+			literals = checked(realloc(literals, literals_size*sizeof(*literals)));
+		}
+		literals[nliterals++] = (struct literal){type, duplicate(text), duplicate(constant), 0};
+	}
+
+	if(!last_line) literals[literal].anywhere = 1;
+	for(int l = line; l <= last_line; ++l) add_site(type, l, literal);
+	return 1;
+}
+
+// ===========================
+// Source scanning
+// ===========================
+static char* read_file(const char* path) {
+	FILE* file = fopen(path, "rb");
+	if(!file) return NULL;
+	size_t size = 0, capacity = 4096;
+	char* data = checked(malloc(capacity));
+	size_t got;
+	while((got = fread(data + size, 1, capacity - size - 1, file)) > 0) {
+		size += got;
+		if(capacity - size == 1) data = checked(realloc(data, capacity *= 2));
+	}
+	data[size] = '\0';
+	fclose(file);
+	return data;
+}
+
+static int is_identifier(char c) {
+	return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+struct cursor {
+	const char* p;
+	int line;
+	const char* line_start;
+};
+
+static void advance(struct cursor* c) {
+	if(*c->p == '\n') {
+		++c->line;
+		c->line_start = c->p + 1;
+	}
+	++c->p;
+}
+
+// Skips a comment at the cursor, if any.
+static int skip_comment(struct cursor* c) {
+	if(c->p[0] == '/' && c->p[1] == '/') {
+		while(*c->p && *c->p != '\n') advance(c);
+		return 1;
+	}
+	if(c->p[0] == '/' && c->p[1] == '*') {
+		advance(c);
+		advance(c);
+		while(*c->p && !(c->p[0] == '*' && c->p[1] == '/')) advance(c);
+		if(*c->p) {
+			advance(c);
+			advance(c);
+		}
+		return 1;
+	}
+	return 0;
+}
+
+static void skip_quoted(struct cursor* c) {
+	char quote = *c->p;
+	advance(c);
+	while(*c->p && *c->p != quote && *c->p != '\n') {
+		if(*c->p == '\\' && c->p[1]) advance(c);
+		advance(c);
+	}
+	if(*c->p == quote) advance(c);
+}
+
+// The argument of the macro call whose '(' is at the cursor, with
+// whitespace and comments collapsed like the preprocessor's # operator does.
+// Returns 0 if the parenthesis is never closed.
+static int read_argument(struct cursor* c, char** text) {
+	size_t capacity = 64, length = 0;
+	char* out = checked(malloc(capacity));
+	int depth = 0, space = 0;
+	advance(c);
+	while(*c->p) {
+		if(skip_comment(c) || *c->p == ' ' || *c->p == '\t' || *c->p == '\n' || *c->p == '\r') {
+			if(*c->p == ' ' || *c->p == '\t' || *c->p == '\n' || *c->p == '\r') advance(c);
+			space = length > 0;
+			continue;
+		}
+		if(*c->p == ')' && !depth) break;
+		if(*c->p == '(') ++depth;
+		if(*c->p == ')') --depth;
+		if(length + 3 > capacity) out = checked(realloc(out, capacity *= 2));
+		if(space) out[length++] = ' ';
+		space = 0;
+		out[length++] = *c->p;
+		advance(c);
+	}
+	out[length] = '\0';
+	*text = out;
+	if(!*c->p) return 0;
+	advance(c);
+	return 1;
+}
+
+// Collects the literals of one source. Returns 0 if any of them is invalid
+// or the file cannot be read.
+static int scan_source(const char* path) {
+	char* data = read_file(path);
+	if(!data) {
+		fprintf(stderr, "creadable_gen: cannot read %s\n", path);
+		return 0;
+	}
+
+	int ok = 1;
+	struct cursor c = {data, 1, data};
+	int line_begins = 1; // nothing but whitespace so far on this line
+	int in_define = 0; // in the body of a #define
+	while(*c.p) {
+		if(skip_comment(&c)) continue;
+		if(c.p[0] == '\\' && c.p[1] == '\n') {
+			advance(&c);
+			advance(&c);
+			continue;
+		}
+		if(*c.p == '"' || *c.p == '\'') {
+			skip_quoted(&c);
+			line_begins = 0;
+			continue;
+		}
+		if(*c.p == '\n') {
+			advance(&c);
+			line_begins = 1;
+			in_define = 0;
+			continue;
+		}
+		if(*c.p == ' ' || *c.p == '\t' || *c.p == '\r') {
+			advance(&c);
+			continue;
+		}
+
+		// the body of a #define is scanned past the name and parameters of
+		// the macro; other directives cannot hold call sites
+		if(*c.p == '#' && line_begins) {
+			advance(&c);
+			while(*c.p == ' ' || *c.p == '\t') advance(&c);
+			if(!strncmp(c.p, "define", 6) && !is_identifier(c.p[6])) {
+				for(int i = 0; i < 6; ++i) advance(&c);
+				while(*c.p == ' ' || *c.p == '\t') advance(&c);
+				while(is_identifier(*c.p)) advance(&c);
+				if(*c.p == '(') {
+					while(*c.p && *c.p != ')' && *c.p != '\n') advance(&c);
+				}
+				in_define = 1;
+				line_begins = 0;
+				continue;
+			}
+			while(*c.p && *c.p != '\n') {
+				if(*c.p == '\\' && c.p[1] == '\n') advance(&c);
+				else if(skip_comment(&c)) continue;
+				advance(&c);
+			}
+			continue;
+		}
+		line_begins = 0;
+
+		if(!is_identifier(*c.p)) {
+			advance(&c);
+			continue;
+		}
+		const char* identifier = c.p;
+		int line = c.line, column = (int)(c.p - c.line_start) + 1;
+		while(is_identifier(*c.p)) advance(&c);
+		size_t length = (size_t)(c.p - identifier);
+		// numbers and member names are not macro calls
+		if(identifier[0] >= '0' && identifier[0] <= '9') continue;
+		if(identifier > data && (identifier[-1] == '.' || (identifier[-1] == '>' && identifier > data + 1 && identifier[-2] == '-'))) continue;
+
+		size_t type = 0;
+		while(type < NTYPES && (strlen(types[type].macro) != length || strncmp(types[type].macro, identifier, length))) ++type;
+		if(type == NTYPES) continue;
+
+		struct cursor after = c;
+		while(*after.p == ' ' || *after.p == '\t' || *after.p == '\n' || *after.p == '\r' || skip_comment(&after)) {
+			if(*after.p == ' ' || *after.p == '\t' || *after.p == '\n' || *after.p == '\r') advance(&after);
+		}
+		if(*after.p != '(') continue;
+
+		c = after;
+		char* text;
+		if(!read_argument(&c, &text)) {
+			fprintf(stderr, "%s:%d:%d: error: unterminated %s(\n", path, line, column, types[type].macro);
+			free(text);
+			ok = 0;
+			break;
+		}
+		// in a macro body the argument may be one of its parameters
+		int parameter = is_identifier(text[0]) && !(text[0] >= '0' && text[0] <= '9');
+		if(!(in_define && parameter) && !add_literal(path, line, column, in_define ? 0 : c.line, type, text)) ok = 0;
+		free(text);
+	}
+	free(data);
+	return ok;
+}
+
+// ===========================
+// Generated header
+// ===========================
+static int compare_sites(const void* a, const void* b) {
+	const struct site* x = a;
+	const struct site* y = b;
+	if(x->type != y->type) return x->type < y->type ? -1 : 1;
+	if(x->line != y->line) return x->line < y->line ? -1 : 1;
+	return (x->literal > y->literal) - (x->literal < y->literal);
+}
+
+static int write_header(const char* path, char** sources, int nsources) {
+	FILE* out = fopen(path, "w");
+	if(!out) {
+		fprintf(stderr, "creadable_gen: cannot write %s\n", path);
+		return 0;
+	}
+
+	fprintf(out, "// Generated by creadable_gen from");
+	for(int i = 0; i < nsources; ++i) fprintf(out, " %s", sources[i]);
+	fprintf(out, ". Do not edit.\n");
+	fprintf(out, "#ifndef CREADABLE_GENERATED\n#define CREADABLE_GENERATED\n\n#include \"creadable.h\"\n\n");
+	// _rgen_<name>_<line> is "~, _rgen_<name>_<line>_" where that line has
+	// literals, so the second argument is its lookup, or else the fallback
+	fprintf(out, "#define _rgen_pick(probe, fallback) _rgen_second(probe, fallback, ~)\n");
+	fprintf(out, "#define _rgen_second(probe, chosen, ...) chosen\n");
+
+	qsort(sites, nsites, sizeof(*sites), compare_sites);
+	struct site* site = sites;
+	for(size_t type = 0; type < NTYPES; ++type) {
+		size_t count = 0;
+		for(size_t i = 0; i < nliterals; ++i) count += literals[i].type == type;
+		if(!count) continue;
+
+		const char* name = types[type].name;
+		int guarded = !strcmp(name, "i128") || !strcmp(name, "u128");
+		fprintf(out, "\n");
+		if(guarded) fprintf(out, "#ifdef __SIZEOF_INT128__\n");
+		fprintf(out, "#undef %s\n", types[type].macro);
+		fprintf(out, "#define %s(...) _rgen_%s(__LINE__, #__VA_ARGS__)\n", types[type].macro, name);
+		fprintf(out, "#define _rgen_%s(line, s) _rgen_%s_at(line, s)\n", name, name);
+		fprintf(out, "#define _rgen_%s_at(line, s) ((%s)_rgen_pick(_rgen_%s_##line, _rgen_%s_any)(s))\n", name, types[type].type, name, name);
+
+		fprintf(out, "#define _rgen_%s_any(s) ( \\\n", name);
+		for(size_t i = 0; i < nliterals; ++i) {
+			if(literals[i].type != type || !literals[i].anywhere) continue;
+			fprintf(out, "\t!__builtin_strcmp(s, \"%s\") ? %s : \\\n", literals[i].text, literals[i].constant);
+		}
+		fprintf(out, "\t_r%s(s))\n", name);
+
+		while(site != sites + nsites && site->type == type) {
+			int line = site->line;
+			fprintf(out, "#define _rgen_%s_%d ~, _rgen_%s_%d_\n", name, line, name, line);
+			fprintf(out, "#define _rgen_%s_%d_(s) ( \\\n", name, line);
+			for(size_t previous = SIZE_MAX; site != sites + nsites && site->type == type && site->line == line; ++site) {
+				if(site->literal == previous) continue;
+				previous = site->literal;
+				fprintf(out, "\t!__builtin_strcmp(s, \"%s\") ? %s : \\\n", literals[site->literal].text, literals[site->literal].constant);
+			}
+			fprintf(out, "\t_rgen_%s_any(s))\n", name);
+		}
+		if(guarded) fprintf(out, "#endif\n");
+	}
+
+	fprintf(out, "\n#endif\n");
+	if(fclose(out)) {
+		fprintf(stderr, "creadable_gen: cannot write %s\n", path);
+		return 0;
+	}
+	return 1;
+}
+
+int main(int argc, char** argv) {
+	const char* output = NULL;
+	char** sources = argv + 1;
+	int nsources = argc - 1;
+	if(argc > 2 && !strcmp(argv[1], "-o")) {
+		output = argv[2];
+		sources += 2;
+		nsources -= 2;
+	}
+	if(!output || nsources < 1) {
+		fprintf(stderr, "usage: %s -o <generated.h> <source.c>...\n", argv[0]);
+		return 2;
+	}
+
+	int ok = 1;
+	for(int i = 0; i < nsources; ++i) ok &= scan_source(sources[i]);
+	if(!ok) return 1;
+	return write_header(output, sources, nsources) ? 0 : 1;
+}